@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+@class NSString;
+
+/// @brief The SGFCBenchmarkBudgets class checks benchmark results against
+/// the performance budgets defined in a JSON file.
+///
+/// The JSON file contains an object with a single key "budgets", whose value
+/// is an array of budget objects. A budget object has these keys:
+/// - "benchmark": The name of the benchmark case. Required.
+/// - "corpus": The name of the corpus entry, or "*" for all corpus entries.
+///   Optional, the default is "*".
+/// - "value": The name of the value to check, as understood by
+///   SGFCBenchmarkResult::valueWithName:(). Required.
+/// - "per": The name of a second value that "value" is divided by before
+///   it is compared to "maximum". Optional.
+/// - "maximum": The maximum permitted value. Required.
+/// - "description": A human readable description of the budget. Optional.
+///
+/// A budget that refers to a duration is skipped if the benchmark results
+/// were produced without measured iterations.
+///
+/// All functions in SGFCBenchmarkBudgets are class methods, so there is no
+/// need to create an instance of SGFCBenchmarkBudgets.
+@interface SGFCBenchmarkBudgets : NSObject
+{
+}
+
+/// @brief Checks the SGFCBenchmarkResult objects in @a results against the
+/// budgets defined in the JSON file @a budgetsFilePath. Prints one line per
+/// budget and corpus entry to stderr. Returns @e YES if all budgets are
+/// met, @e NO if a budget is exceeded, if a budget matches no result, if a
+/// budget refers to an unknown value, or if the file cannot be read.
++ (BOOL) checkResults:(NSArray*)results
+  againstBudgetsInFile:(NSString*)budgetsFilePath;
+
+@end
@@ -0,0 +1,190 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarkBudgets.h"
+#import "SGFCBenchmarkRunner.h"
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSData.h>
+#import <Foundation/NSDictionary.h>
+#import <Foundation/NSJSONSerialization.h>
+#import <Foundation/NSString.h>
+#import <Foundation/NSValue.h>
+
+// C++ Standard Library includes
+#import <cstdio>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  void PrintBudgetLine(const char* status, NSDictionary* budget, NSString* corpusName, NSString* details)
+  {
+    fprintf(stderr, "%s %s %s %s%s%s: %s\n",
+            status,
+            [budget[@"benchmark"] UTF8String],
+            [corpusName UTF8String],
+            [budget[@"value"] UTF8String],
+            budget[@"per"] ? " per " : "",
+            budget[@"per"] ? [budget[@"per"] UTF8String] : "",
+            [details UTF8String]);
+  }
+
+  BOOL IsValidBudget(id budget)
+  {
+    if (! [budget isKindOfClass:[NSDictionary class]])
+      return NO;
+
+    NSDictionary* budgetDictionary = budget;
+    if (! [budgetDictionary[@"benchmark"] isKindOfClass:[NSString class]])
+      return NO;
+    if (! [budgetDictionary[@"value"] isKindOfClass:[NSString class]])
+      return NO;
+    if (! [budgetDictionary[@"maximum"] isKindOfClass:[NSNumber class]])
+      return NO;
+    if (budgetDictionary[@"corpus"] && ! [budgetDictionary[@"corpus"] isKindOfClass:[NSString class]])
+      return NO;
+    if (budgetDictionary[@"per"] && ! [budgetDictionary[@"per"] isKindOfClass:[NSString class]])
+      return NO;
+
+    return YES;
+  }
+}
+
+@implementation SGFCBenchmarkBudgets
+
+#pragma mark - Public API
+
++ (BOOL) checkResults:(NSArray*)results
+  againstBudgetsInFile:(NSString*)budgetsFilePath
+{
+  NSData* budgetsData = [NSData dataWithContentsOfFile:budgetsFilePath];
+  if (! budgetsData)
+  {
+    fprintf(stderr, "Failed to read budgets from %s\n", [budgetsFilePath UTF8String]);
+    return NO;
+  }
+
+  id budgetsObject = [NSJSONSerialization JSONObjectWithData:budgetsData options:0 error:nil];
+  NSArray* budgets = [budgetsObject isKindOfClass:[NSDictionary class]] ? budgetsObject[@"budgets"] : nil;
+  if (! [budgets isKindOfClass:[NSArray class]])
+  {
+    fprintf(stderr, "%s does not contain a \"budgets\" array\n", [budgetsFilePath UTF8String]);
+    return NO;
+  }
+
+  BOOL allBudgetsMet = YES;
+  NSUInteger numberOfExceededBudgets = 0;
+
+  for (id budget in budgets)
+  {
+    if (! IsValidBudget(budget))
+    {
+      fprintf(stderr, "FAIL Invalid budget: %s\n", [[budget description] UTF8String]);
+      allBudgetsMet = NO;
+      continue;
+    }
+
+    if (! [self checkResults:results againstBudget:budget numberOfExceededBudgets:&numberOfExceededBudgets])
+      allBudgetsMet = NO;
+  }
+
+  if (numberOfExceededBudgets > 0)
+    fprintf(stderr, "%lu budget(s) exceeded\n", static_cast<unsigned long>(numberOfExceededBudgets));
+
+  return allBudgetsMet;
+}
+
+#pragma mark - Private API
+
+// Checks all results that match @a budget. Returns NO if at least one of
+// the results exceeds the budget, or if the budget is not applicable to
+// any of the results.
++ (BOOL) checkResults:(NSArray*)results
+        againstBudget:(NSDictionary*)budget
+numberOfExceededBudgets:(NSUInteger*)numberOfExceededBudgets
+{
+  NSString* benchmarkName = budget[@"benchmark"];
+  NSString* corpusName = budget[@"corpus"] ? budget[@"corpus"] : @"*";
+  NSString* valueName = budget[@"value"];
+  NSString* denominatorName = budget[@"per"];
+  double maximum = [budget[@"maximum"] doubleValue];
+
+  BOOL budgetMet = YES;
+  NSUInteger numberOfMatchingResults = 0;
+
+  for (SGFCBenchmarkResult* result in results)
+  {
+    if (! [result.benchmarkName isEqualToString:benchmarkName])
+      continue;
+    if (! [corpusName isEqualToString:@"*"] && ! [result.corpusName isEqualToString:corpusName])
+      continue;
+
+    numberOfMatchingResults++;
+
+    NSNumber* value = [result valueWithName:valueName];
+    NSNumber* denominator = denominatorName ? [result valueWithName:denominatorName] : @1;
+    if (! value || ! denominator)
+    {
+      // valueWithName:() returns nil for durations if there were no
+      // measured iterations
+      if (result.numberOfIterations == 0 && [valueName hasSuffix:@"Seconds"])
+      {
+        PrintBudgetLine("SKIP", budget, result.corpusName, @"no measured iterations");
+      }
+      else
+      {
+        PrintBudgetLine("FAIL", budget, result.corpusName, @"unknown value name");
+        budgetMet = NO;
+      }
+      continue;
+    }
+
+    if (denominator.doubleValue == 0.0)
+    {
+      PrintBudgetLine("FAIL", budget, result.corpusName, @"denominator is 0");
+      budgetMet = NO;
+      continue;
+    }
+
+    double actual = value.doubleValue / denominator.doubleValue;
+    NSString* details = [NSString stringWithFormat:@"%g (maximum %g)", actual, maximum];
+    if (actual <= maximum)
+    {
+      PrintBudgetLine("PASS", budget, result.corpusName, details);
+    }
+    else
+    {
+      if (budget[@"description"])
+        details = [details stringByAppendingFormat:@" - %@", budget[@"description"]];
+      PrintBudgetLine("FAIL", budget, result.corpusName, details);
+      budgetMet = NO;
+      (*numberOfExceededBudgets)++;
+    }
+  }
+
+  if (numberOfMatchingResults == 0)
+  {
+    PrintBudgetLine("FAIL", budget, corpusName, @"no matching benchmark result");
+    budgetMet = NO;
+  }
+
+  return budgetMet;
+}
+
+@end
@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+@class NSString;
+
+/// @brief The SGFCBenchmarkCorpusSpec class describes the shape of a
+/// synthetic SGF document that SGFCBenchmarkCorpus generates.
+@interface SGFCBenchmarkCorpusSpec : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCBenchmarkCorpusSpec object with
+/// the specified values and a seed that is derived from @a name.
++ (instancetype) specWithName:(NSString*)name
+                numberOfGames:(NSUInteger)numberOfGames
+          numberOfMovesPerGame:(NSUInteger)numberOfMovesPerGame
+             variationDensity:(NSUInteger)variationDensity
+                commentLength:(NSUInteger)commentLength
+                    boardSize:(NSUInteger)boardSize;
+
+/// @brief The name of the corpus entry. Appears in the benchmark output.
+@property(nonatomic, strong) NSString* name;
+
+/// @brief The number of games in the collection.
+@property(nonatomic, assign) NSUInteger numberOfGames;
+
+/// @brief The number of moves in the main variation of each game.
+@property(nonatomic, assign) NSUInteger numberOfMovesPerGame;
+
+/// @brief The probability, in 1/1000, that a move in the main variation is
+/// followed by a side variation in addition to the next main variation
+/// move. Side variations do not branch further.
+@property(nonatomic, assign) NSUInteger variationDensity;
+
+/// @brief The number of characters of the comment (C property) that every
+/// move node carries. 0 means that move nodes have no comment.
+@property(nonatomic, assign) NSUInteger commentLength;
+
+/// @brief The size of the square Go board. Must be between 1 and 52.
+@property(nonatomic, assign) NSUInteger boardSize;
+
+/// @brief The seed of the pseudo-random number generator. The same spec
+/// with the same seed always generates the same SGF content.
+@property(nonatomic, assign) unsigned long long seed;
+
+@end
+
+/// @brief The SGFCBenchmarkCorpus class generates deterministic synthetic
+/// SGF documents for benchmarking.
+///
+/// All functions in SGFCBenchmarkCorpus are class methods, so there is no
+/// need to create an instance of SGFCBenchmarkCorpus.
+///
+/// The generated documents contain Go games. Every game has a root node with
+/// the usual game info properties, followed by alternating black and white
+/// moves at pseudo-random board positions. The generator does not play by
+/// the rules, so SGFC may report warnings about e.g. moves on occupied
+/// points. This is intended: checking is part of what is being measured.
+@interface SGFCBenchmarkCorpus : NSObject
+{
+}
+
+/// @brief Returns the standard corpus, i.e. a collection of
+/// SGFCBenchmarkCorpusSpec objects that cover a range of document sizes,
+/// variation densities, comment sizes, collection sizes and board sizes.
++ (NSArray*) standardCorpus;
+
+/// @brief Returns the SGF content generated for @a spec.
++ (NSString*) sgfContentWithSpec:(SGFCBenchmarkCorpusSpec*)spec;
+
+@end
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarkCorpus.h"
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSString.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+#import <cstdint>
+#import <string>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // A small pseudo-random number generator (SplitMix64) whose output is
+  // defined by the algorithm alone, unlike the distributions of the C++
+  // Standard Library whose output differs between implementations.
+  class RandomNumberGenerator
+  {
+  public:
+    explicit RandomNumberGenerator(std::uint64_t seed)
+      : state(seed)
+    {
+    }
+
+    std::uint64_t Next()
+    {
+      std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+    }
+
+    // Returns a number in the range [0, upperBound)
+    std::uint64_t Next(std::uint64_t upperBound)
+    {
+      return Next() % upperBound;
+    }
+
+  private:
+    std::uint64_t state;
+  };
+
+  // FNV-1a
+  std::uint64_t SeedFromName(NSString* name)
+  {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char* character = [name UTF8String]; *character != '\0'; character++)
+    {
+      hash ^= static_cast<unsigned char>(*character);
+      hash *= 0x100000001b3ULL;
+    }
+    return hash;
+  }
+
+  const char* BoardCoordinates = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const char* CommentWords[] = { "lorem", "ipsum", "dolor", "sit", "amet", "joseki", "tesuji", "sente", "gote", "ko" };
+  const std::uint64_t NumberOfCommentWords = sizeof(CommentWords) / sizeof(CommentWords[0]);
+
+  // The length of a side variation
+  const NSUInteger SideVariationLength = 10;
+
+  class SgfGenerator
+  {
+  public:
+    explicit SgfGenerator(SGFCBenchmarkCorpusSpec* spec)
+      : rng(spec.seed)
+      , boardSize(std::min<NSUInteger>(std::max<NSUInteger>(spec.boardSize, 1), 52))
+      , variationDensity(spec.variationDensity)
+      , commentLength(spec.commentLength)
+    {
+    }
+
+    void AppendGame(std::string& sgf, NSUInteger gameIndex, NSUInteger numberOfMoves)
+    {
+      sgf += "(;FF[4]GM[1]CA[UTF-8]AP[SgfcKit-benchmark:1.0]SZ[";
+      sgf += std::to_string(boardSize);
+      sgf += "]PB[Black ";
+      sgf += std::to_string(gameIndex + 1);
+      sgf += "]PW[White ";
+      sgf += std::to_string(gameIndex + 1);
+      sgf += "]KM[6.5]RU[Japanese]DT[2026-01-01]RE[B+R]";
+
+      bool isBlackToMove = true;
+      AppendSequence(sgf, numberOfMoves, isBlackToMove, true);
+
+      sgf += ")\n";
+    }
+
+  private:
+    // Appends @a numberOfMoves move nodes. If @a allowVariations is true the
+    // sequence may end in a branch point where the main variation continues
+    // in the first subtree and a side variation is in the second subtree.
+    void AppendSequence(std::string& sgf, NSUInteger numberOfMoves, bool& isBlackToMove, bool allowVariations)
+    {
+      // Iterate over branch points instead of recursing so that documents
+      // with many branch points do not need a deep call stack. Each branch
+      // point opens a subtree that is closed at the end.
+      NSUInteger numberOfOpenSubtrees = 0;
+
+      for (NSUInteger moveIndex = 0; moveIndex < numberOfMoves; moveIndex++)
+      {
+        AppendMoveNode(sgf, isBlackToMove);
+        isBlackToMove = ! isBlackToMove;
+
+        NSUInteger numberOfRemainingMoves = numberOfMoves - moveIndex - 1;
+        if (allowVariations && numberOfRemainingMoves > 0 && rng.Next(1000) < variationDensity)
+        {
+          // The side variation comes second so that the main variation
+          // remains the first child all the way down
+          bool isBlackToMoveInSideVariation = isBlackToMove;
+          std::string sideVariation = "(";
+          AppendSequence(sideVariation, std::min(numberOfRemainingMoves, SideVariationLength), isBlackToMoveInSideVariation, false);
+          sideVariation += ")";
+
+          sgf += "(";
+          pendingSideVariations.push_back(sideVariation);
+          numberOfOpenSubtrees++;
+        }
+      }
+
+      for (; numberOfOpenSubtrees > 0; numberOfOpenSubtrees--)
+      {
+        sgf += ")";
+        sgf += pendingSideVariations.back();
+        pendingSideVariations.pop_back();
+      }
+    }
+
+    void AppendMoveNode(std::string& sgf, bool isBlackToMove)
+    {
+      sgf += isBlackToMove ? ";B[" : ";W[";
+      sgf += BoardCoordinates[rng.Next(boardSize)];
+      sgf += BoardCoordinates[rng.Next(boardSize)];
+      sgf += "]";
+
+      if (commentLength > 0)
+      {
+        sgf += "C[";
+        std::string::size_type commentStart = sgf.size();
+        while (sgf.size() - commentStart < commentLength)
+        {
+          if (sgf.size() > commentStart)
+            sgf += ' ';
+          sgf += CommentWords[rng.Next(NumberOfCommentWords)];
+        }
+        sgf.resize(commentStart + commentLength);
+        sgf += "]";
+      }
+    }
+
+    RandomNumberGenerator rng;
+    NSUInteger boardSize;
+    NSUInteger variationDensity;
+    NSUInteger commentLength;
+    std::vector<std::string> pendingSideVariations;
+  };
+}
+
+@implementation SGFCBenchmarkCorpusSpec
+
++ (instancetype) specWithName:(NSString*)name
+                numberOfGames:(NSUInteger)numberOfGames
+          numberOfMovesPerGame:(NSUInteger)numberOfMovesPerGame
+             variationDensity:(NSUInteger)variationDensity
+                commentLength:(NSUInteger)commentLength
+                    boardSize:(NSUInteger)boardSize
+{
+  SGFCBenchmarkCorpusSpec* spec = [[SGFCBenchmarkCorpusSpec alloc] init];
+  spec.name = name;
+  spec.numberOfGames = numberOfGames;
+  spec.numberOfMovesPerGame = numberOfMovesPerGame;
+  spec.variationDensity = variationDensity;
+  spec.commentLength = commentLength;
+  spec.boardSize = boardSize;
+  spec.seed = SeedFromName(name);
+  return spec;
+}
+
+@end
+
+@implementation SGFCBenchmarkCorpus
+
++ (NSArray*) standardCorpus
+{
+  return @[
+    // Size range
+    [SGFCBenchmarkCorpusSpec specWithName:@"tiny" numberOfGames:1 numberOfMovesPerGame:50 variationDensity:0 commentLength:0 boardSize:19],
+    [SGFCBenchmarkCorpusSpec specWithName:@"small" numberOfGames:1 numberOfMovesPerGame:250 variationDensity:20 commentLength:40 boardSize:19],
+    [SGFCBenchmarkCorpusSpec specWithName:@"medium" numberOfGames:1 numberOfMovesPerGame:1000 variationDensity:20 commentLength:40 boardSize:19],
+    [SGFCBenchmarkCorpusSpec specWithName:@"large" numberOfGames:1 numberOfMovesPerGame:5000 variationDensity:20 commentLength:40 boardSize:19],
+    // Variation density
+    [SGFCBenchmarkCorpusSpec specWithName:@"variations-dense" numberOfGames:1 numberOfMovesPerGame:1000 variationDensity:250 commentLength:0 boardSize:19],
+    // Comment size
+    [SGFCBenchmarkCorpusSpec specWithName:@"comments-large" numberOfGames:1 numberOfMovesPerGame:1000 variationDensity:0 commentLength:2000 boardSize:19],
+    // Collection size
+    [SGFCBenchmarkCorpusSpec specWithName:@"collection" numberOfGames:100 numberOfMovesPerGame:200 variationDensity:20 commentLength:40 boardSize:19],
+    // Board size
+    [SGFCBenchmarkCorpusSpec specWithName:@"board-9x9" numberOfGames:1 numberOfMovesPerGame:1000 variationDensity:20 commentLength:40 boardSize:9],
+    [SGFCBenchmarkCorpusSpec specWithName:@"board-52x52" numberOfGames:1 numberOfMovesPerGame:1000 variationDensity:20 commentLength:40 boardSize:52],
+  ];
+}
+
++ (NSString*) sgfContentWithSpec:(SGFCBenchmarkCorpusSpec*)spec
+{
+  SgfGenerator generator(spec);
+
+  std::string sgf;
+  for (NSUInteger gameIndex = 0; gameIndex < spec.numberOfGames; gameIndex++)
+    generator.AppendGame(sgf, gameIndex, spec.numberOfMovesPerGame);
+
+  return [NSString stringWithUTF8String:sgf.c_str()];
+}
+
+@end
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// SgfcKit includes
+#import <SGFCKitMetrics.h>
+
+// System includes
+#import <Foundation/NSDate.h>
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+@class NSString;
+@class SGFCBenchmarkCorpusSpec;
+
+/// @brief A block that prepares one run of a benchmark case for the corpus
+/// entry @a spec, whose generated SGF content is @a sgfContent. The returned
+/// object is passed to every invocation of the case's run block. @a spec and
+/// @a sgfContent are @e nil for benchmark cases that do not use the corpus.
+typedef id (^SGFCBenchmarkSetUpBlock)(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent);
+
+/// @brief A block that performs the measured operation once. @a context is
+/// the object returned by the case's set up block.
+typedef void (^SGFCBenchmarkRunBlock)(id context);
+
+/// @brief The SGFCBenchmarkCase class describes a single benchmark.
+@interface SGFCBenchmarkCase : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCBenchmarkCase object that is run
+/// once for every entry of the corpus.
++ (instancetype) caseWithName:(NSString*)name
+                     setUpBlock:(SGFCBenchmarkSetUpBlock)setUpBlock
+                       runBlock:(SGFCBenchmarkRunBlock)runBlock;
+
+/// @brief Returns a newly constructed SGFCBenchmarkCase object that does
+/// not use the corpus and is therefore run only once.
++ (instancetype) corpusIndependentCaseWithName:(NSString*)name
+                                      setUpBlock:(SGFCBenchmarkSetUpBlock)setUpBlock
+                                        runBlock:(SGFCBenchmarkRunBlock)runBlock;
+
+@property(nonatomic, strong) NSString* name;
+@property(nonatomic, assign) BOOL usesCorpus;
+@property(nonatomic, copy) SGFCBenchmarkSetUpBlock setUpBlock;
+@property(nonatomic, copy) SGFCBenchmarkRunBlock runBlock;
+
+@end
+
+/// @brief The SGFCBenchmarkResult class holds the result of running one
+/// benchmark case for one corpus entry.
+@interface SGFCBenchmarkResult : NSObject
+{
+}
+
+/// @brief The name of the benchmark case.
+@property(nonatomic, strong) NSString* benchmarkName;
+
+/// @brief The name of the corpus entry. An empty string for benchmark cases
+/// that do not use the corpus.
+@property(nonatomic, strong) NSString* corpusName;
+
+/// @brief The number of bytes of the corpus entry's SGF content in UTF-8.
+@property(nonatomic, assign) unsigned long long inputByteCount;
+
+/// @brief The number of nodes, properties and property values in the
+/// document of the corpus entry. 0 for benchmark cases that do not use the
+/// corpus. These values are the denominators of most performance budgets.
+@property(nonatomic, assign) NSUInteger corpusNodeCount;
+@property(nonatomic, assign) NSUInteger corpusPropertyCount;
+@property(nonatomic, assign) NSUInteger corpusPropertyValueCount;
+
+@property(nonatomic, assign) NSUInteger numberOfIterations;
+@property(nonatomic, assign) NSTimeInterval minimumDuration;
+@property(nonatomic, assign) NSTimeInterval medianDuration;
+@property(nonatomic, assign) NSTimeInterval meanDuration;
+@property(nonatomic, assign) NSTimeInterval maximumDuration;
+
+/// @brief The SGFCKitMetrics counters collected during a single, separate
+/// iteration. Unlike the durations these values are deterministic.
+@property(nonatomic, assign) SGFCKitMetricsSnapshot metrics;
+
+/// @brief Returns the value named @a valueName, or @e nil if there is no
+/// value with that name.
+///
+/// The value names are the names used in the output for the SGFCKitMetrics
+/// counters (e.g. "nodeWrapperCount"), the corpus counts (e.g.
+/// "corpusNodeCount"), "inputByteCount" and the durations
+/// (e.g. "medianSeconds"). The durations are @e nil if numberOfIterations()
+/// is 0.
+- (NSNumber*) valueWithName:(NSString*)valueName;
+
+@end
+
+/// @brief The SGFCBenchmarkRunner class runs benchmark cases and formats
+/// their results.
+@interface SGFCBenchmarkRunner : NSObject
+{
+}
+
+/// @brief The number of measured iterations per benchmark case and corpus
+/// entry. The default is 5.
+@property(nonatomic, assign) NSUInteger numberOfIterations;
+
+/// @brief If not @e nil, only benchmark cases whose name contains this
+/// string are run. The default is @e nil.
+@property(nonatomic, strong) NSString* filter;
+
+/// @brief Runs every benchmark case in @a benchmarkCases that matches
+/// filter(), for every entry in @a corpus where applicable. Returns a
+/// collection of SGFCBenchmarkResult objects.
+- (NSArray*) runBenchmarkCases:(NSArray*)benchmarkCases
+                    withCorpus:(NSArray*)corpus;
+
+/// @brief Returns @a results formatted as a JSON document.
++ (NSString*) jsonStringWithResults:(NSArray*)results;
+
+/// @brief Returns @a results formatted as CSV, with a header line.
++ (NSString*) csvStringWithResults:(NSArray*)results;
+
+@end
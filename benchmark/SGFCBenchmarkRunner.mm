@@ -0,0 +1,338 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarkCorpus.h"
+#import "SGFCBenchmarkRunner.h"
+
+// SgfcKit includes
+#import <SGFCDocumentReader.h>
+#import <SGFCDocumentReadResult.h>
+#import <SGFCDocumentReadStatistics.h>
+#import <SGFCKitFactory.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSAutoreleasePool.h>
+#import <Foundation/NSData.h>
+#import <Foundation/NSDictionary.h>
+#import <Foundation/NSJSONSerialization.h>
+#import <Foundation/NSString.h>
+#import <Foundation/NSValue.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+#import <chrono>
+#import <cstdio>
+#import <numeric>
+#import <utility>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // Returns the counters in @a metrics that are relevant for benchmarking,
+  // in a stable order. Durations are omitted because they are not
+  // deterministic and the benchmark measures durations itself.
+  std::vector<std::pair<NSString*, NSNumber*>> MetricsAsKeyValuePairs(const SGFCKitMetricsSnapshot& metrics)
+  {
+    return
+    {
+      { @"readCount", @(metrics.ReadCount) },
+      { @"writeCount", @(metrics.WriteCount) },
+      { @"bytesRead", @(metrics.BytesRead) },
+      { @"bytesWritten", @(metrics.BytesWritten) },
+      { @"nodeCount", @(metrics.NodeCount) },
+      { @"propertyCount", @(metrics.PropertyCount) },
+      { @"propertyValueCount", @(metrics.PropertyValueCount) },
+      { @"documentWrapperCount", @(metrics.DocumentWrapperCount) },
+      { @"gameWrapperCount", @(metrics.GameWrapperCount) },
+      { @"nodeWrapperCount", @(metrics.NodeWrapperCount) },
+      { @"propertyWrapperCount", @(metrics.PropertyWrapperCount) },
+      { @"propertyValueWrapperCount", @(metrics.PropertyValueWrapperCount) },
+      { @"goObjectWrapperCount", @(metrics.GoObjectWrapperCount) },
+      { @"messageWrapperCount", @(metrics.MessageWrapperCount) },
+      { @"otherWrapperCount", @(metrics.OtherWrapperCount) },
+      { @"mappingCount", @(metrics.MappingCount) },
+      { @"stringCopyCount", @(metrics.StringCopyCount) },
+      { @"libSgfcObjectCount", @(metrics.LibSgfcObjectCount) },
+      { @"backgroundReclamationCount", @(metrics.BackgroundReclamationCount) },
+    };
+  }
+
+  NSTimeInterval Median(std::vector<NSTimeInterval> durations)
+  {
+    std::sort(durations.begin(), durations.end());
+    std::size_t middle = durations.size() / 2;
+    if (durations.size() % 2 == 1)
+      return durations[middle];
+    else
+      return (durations[middle - 1] + durations[middle]) / 2.0;
+  }
+}
+
+@implementation SGFCBenchmarkCase
+
++ (instancetype) caseWithName:(NSString*)name
+                     setUpBlock:(SGFCBenchmarkSetUpBlock)setUpBlock
+                       runBlock:(SGFCBenchmarkRunBlock)runBlock
+{
+  SGFCBenchmarkCase* benchmarkCase = [[SGFCBenchmarkCase alloc] init];
+  benchmarkCase.name = name;
+  benchmarkCase.usesCorpus = YES;
+  benchmarkCase.setUpBlock = setUpBlock;
+  benchmarkCase.runBlock = runBlock;
+  return benchmarkCase;
+}
+
++ (instancetype) corpusIndependentCaseWithName:(NSString*)name
+                                      setUpBlock:(SGFCBenchmarkSetUpBlock)setUpBlock
+                                        runBlock:(SGFCBenchmarkRunBlock)runBlock
+{
+  SGFCBenchmarkCase* benchmarkCase = [SGFCBenchmarkCase caseWithName:name setUpBlock:setUpBlock runBlock:runBlock];
+  benchmarkCase.usesCorpus = NO;
+  return benchmarkCase;
+}
+
+@end
+
+@implementation SGFCBenchmarkResult
+
+- (NSNumber*) valueWithName:(NSString*)valueName
+{
+  if ([valueName isEqualToString:@"inputByteCount"])
+    return @(self.inputByteCount);
+  else if ([valueName isEqualToString:@"corpusNodeCount"])
+    return @(self.corpusNodeCount);
+  else if ([valueName isEqualToString:@"corpusPropertyCount"])
+    return @(self.corpusPropertyCount);
+  else if ([valueName isEqualToString:@"corpusPropertyValueCount"])
+    return @(self.corpusPropertyValueCount);
+
+  // The durations are meaningless without measured iterations
+  NSDictionary* durations = @{
+    @"minimumSeconds" : @(self.minimumDuration),
+    @"medianSeconds" : @(self.medianDuration),
+    @"meanSeconds" : @(self.meanDuration),
+    @"maximumSeconds" : @(self.maximumDuration),
+  };
+  if (durations[valueName])
+    return (self.numberOfIterations > 0) ? durations[valueName] : nil;
+
+  for (const auto& [key, value] : MetricsAsKeyValuePairs(self.metrics))
+  {
+    if ([key isEqualToString:valueName])
+      return value;
+  }
+
+  return nil;
+}
+
+@end
+
+@implementation SGFCBenchmarkRunner
+
+#pragma mark - Initialization and deallocation
+
+- (instancetype) init
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  _numberOfIterations = 5;
+  _filter = nil;
+
+  return self;
+}
+
+#pragma mark - Public API
+
+- (NSArray*) runBenchmarkCases:(NSArray*)benchmarkCases
+                    withCorpus:(NSArray*)corpus
+{
+  NSMutableArray* results = [NSMutableArray array];
+
+  // Generating the SGF content is not part of any measurement, and the
+  // content is the same for all benchmark cases. The same goes for the
+  // shape of the generated documents.
+  NSMutableArray* sgfContents = [NSMutableArray array];
+  NSMutableArray* corpusStatistics = [NSMutableArray array];
+  for (SGFCBenchmarkCorpusSpec* spec in corpus)
+  {
+    NSString* sgfContent = [SGFCBenchmarkCorpus sgfContentWithSpec:spec];
+    [sgfContents addObject:sgfContent];
+
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    [corpusStatistics addObject:[reader readSgfContentFromString:sgfContent].statistics];
+  }
+
+  for (SGFCBenchmarkCase* benchmarkCase in benchmarkCases)
+  {
+    if (self.filter && [benchmarkCase.name rangeOfString:self.filter].location == NSNotFound)
+      continue;
+
+    if (benchmarkCase.usesCorpus)
+    {
+      for (NSUInteger corpusIndex = 0; corpusIndex < corpus.count; corpusIndex++)
+      {
+        SGFCBenchmarkResult* result = [self runBenchmarkCase:benchmarkCase
+                                                    withSpec:corpus[corpusIndex]
+                                                  sgfContent:sgfContents[corpusIndex]];
+
+        SGFCDocumentReadStatistics* statistics = corpusStatistics[corpusIndex];
+        result.corpusNodeCount = statistics.nodeCount;
+        result.corpusPropertyCount = statistics.propertyCount;
+        result.corpusPropertyValueCount = statistics.propertyValueCount;
+
+        [results addObject:result];
+      }
+    }
+    else
+    {
+      [results addObject:[self runBenchmarkCase:benchmarkCase
+                                       withSpec:nil
+                                     sgfContent:nil]];
+    }
+  }
+
+  return results;
+}
+
++ (NSString*) jsonStringWithResults:(NSArray*)results
+{
+  NSMutableArray* resultsAsDictionaries = [NSMutableArray array];
+
+  for (SGFCBenchmarkResult* result in results)
+  {
+    NSMutableDictionary* metrics = [NSMutableDictionary dictionary];
+    for (const auto& [key, value] : MetricsAsKeyValuePairs(result.metrics))
+      metrics[key] = value;
+
+    [resultsAsDictionaries addObject:@{
+      @"benchmark" : result.benchmarkName,
+      @"corpus" : result.corpusName,
+      @"inputByteCount" : @(result.inputByteCount),
+      @"corpusNodeCount" : @(result.corpusNodeCount),
+      @"corpusPropertyCount" : @(result.corpusPropertyCount),
+      @"corpusPropertyValueCount" : @(result.corpusPropertyValueCount),
+      @"iterations" : @(result.numberOfIterations),
+      @"minimumSeconds" : @(result.minimumDuration),
+      @"medianSeconds" : @(result.medianDuration),
+      @"meanSeconds" : @(result.meanDuration),
+      @"maximumSeconds" : @(result.maximumDuration),
+      @"metrics" : metrics,
+    }];
+  }
+
+  NSData* jsonData = [NSJSONSerialization dataWithJSONObject:@{ @"results" : resultsAsDictionaries }
+                                                     options:NSJSONWritingPrettyPrinted
+                                                       error:nil];
+  return [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+}
+
++ (NSString*) csvStringWithResults:(NSArray*)results
+{
+  NSMutableString* csvString = [NSMutableString string];
+
+  [csvString appendString:@"benchmark,corpus,inputByteCount,corpusNodeCount,corpusPropertyCount,corpusPropertyValueCount,iterations,minimumSeconds,medianSeconds,meanSeconds,maximumSeconds"];
+  for (const auto& keyValuePair : MetricsAsKeyValuePairs(SGFCKitMetricsSnapshot()))
+    [csvString appendFormat:@",%@", keyValuePair.first];
+  [csvString appendString:@"\n"];
+
+  // Benchmark and corpus names never contain commas or quotes, so no
+  // quoting is necessary
+  for (SGFCBenchmarkResult* result in results)
+  {
+    [csvString appendFormat:@"%@,%@,%llu,%lu,%lu,%lu,%lu,%.9f,%.9f,%.9f,%.9f",
+     result.benchmarkName,
+     result.corpusName,
+     result.inputByteCount,
+     static_cast<unsigned long>(result.corpusNodeCount),
+     static_cast<unsigned long>(result.corpusPropertyCount),
+     static_cast<unsigned long>(result.corpusPropertyValueCount),
+     static_cast<unsigned long>(result.numberOfIterations),
+     result.minimumDuration,
+     result.medianDuration,
+     result.meanDuration,
+     result.maximumDuration];
+    for (const auto& keyValuePair : MetricsAsKeyValuePairs(result.metrics))
+      [csvString appendFormat:@",%@", keyValuePair.second];
+    [csvString appendString:@"\n"];
+  }
+
+  return csvString;
+}
+
+#pragma mark - Private API
+
+- (SGFCBenchmarkResult*) runBenchmarkCase:(SGFCBenchmarkCase*)benchmarkCase
+                                 withSpec:(SGFCBenchmarkCorpusSpec*)spec
+                               sgfContent:(NSString*)sgfContent
+{
+  NSString* corpusName = spec ? spec.name : @"";
+  fprintf(stderr, "Running %s %s\n", [benchmarkCase.name UTF8String], [corpusName UTF8String]);
+
+  SGFCBenchmarkResult* result = [[SGFCBenchmarkResult alloc] init];
+  result.benchmarkName = benchmarkCase.name;
+  result.corpusName = corpusName;
+  result.inputByteCount = [sgfContent lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  result.numberOfIterations = self.numberOfIterations;
+
+  id context = benchmarkCase.setUpBlock ? benchmarkCase.setUpBlock(spec, sgfContent) : nil;
+
+  // One iteration with metrics enabled, to collect the deterministic
+  // counters. This iteration also serves as warm-up, the measured
+  // iterations below run with metrics disabled so that the instrumentation
+  // does not distort the durations.
+  BOOL wasMetricsEnabled = [SGFCKitMetrics isEnabled];
+  [SGFCKitMetrics reset];
+  [SGFCKitMetrics setEnabled:YES];
+  @autoreleasepool
+  {
+    benchmarkCase.runBlock(context);
+  }
+  [SGFCKitMetrics setEnabled:NO];
+  result.metrics = [SGFCKitMetrics snapshot];
+
+  std::vector<NSTimeInterval> durations;
+  for (NSUInteger iteration = 0; iteration < self.numberOfIterations; iteration++)
+  {
+    auto startTime = std::chrono::steady_clock::now();
+    @autoreleasepool
+    {
+      benchmarkCase.runBlock(context);
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+    durations.push_back(duration.count());
+  }
+
+  [SGFCKitMetrics setEnabled:wasMetricsEnabled];
+
+  if (! durations.empty())
+  {
+    result.minimumDuration = *std::min_element(durations.begin(), durations.end());
+    result.maximumDuration = *std::max_element(durations.begin(), durations.end());
+    result.meanDuration = std::accumulate(durations.begin(), durations.end(), 0.0) / durations.size();
+    result.medianDuration = Median(durations);
+  }
+
+  return result;
+}
+
+@end
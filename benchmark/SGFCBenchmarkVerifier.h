@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+
+/// @brief The SGFCBenchmarkVerifier class checks that the alternative read
+/// and write paths of the library produce the same object tree as the
+/// regular SGFC-based path.
+///
+/// All functions in SGFCBenchmarkVerifier are class methods, so there is no
+/// need to create an instance of SGFCBenchmarkVerifier.
+///
+/// The checks run on the SGF content of the benchmark corpus, and on a
+/// number of small hand-written SGF samples that cover features the
+/// synthetic corpus does not contain, such as escaped characters, line
+/// breaks and composed property values. These are the checks:
+/// - snapshot.roundtrip: A document that was read by SGFC is encoded into
+///   an SGFCDocumentSnapshot and decoded again. The decoded document must
+///   have the same object tree as the original document, and
+///   SGFCDocumentWriter must generate the same SGF content for both
+///   documents.
+/// - trusted.differential: The SGF content is normalized by reading it with
+///   SGFC and writing it with SGFCDocumentWriter. The normalized content is
+///   then read both by SGFC and by an SGFCDocumentReader that trusts its
+///   input. The second read must bypass SGFC, and both documents must have
+///   the same object tree. The check is repeated with the encoding name in
+///   the CA property in lowercase.
+///
+/// Two object trees are the same if they have the same games, the same
+/// nodes in the same tree structure, and the same properties with the same
+/// raw and typed property values.
+///
+/// A separate check, frozen.concurrentreads, makes sure that a frozen
+/// SGFCDocument can be read by many threads at the same time. A number of
+/// threads traverse the entire object tree of the same frozen document
+/// simultaneously. Each thread must see the same object tree as a serial
+/// traversal of an unfrozen document. The check is most useful in a build
+/// with ThreadSanitizer, because a data race does not necessarily lead to a
+/// wrong result.
+@interface SGFCBenchmarkVerifier : NSObject
+{
+}
+
+/// @brief Runs all checks on the SGF content generated for the
+/// SGFCBenchmarkCorpusSpec objects in @a corpus and on the hand-written
+/// samples. Prints one line per check and SGF content to stderr. Returns
+/// @e YES if all checks pass, @e NO if at least one check fails.
++ (BOOL) verifyWithCorpus:(NSArray*)corpus;
+
+/// @brief Runs the check frozen.concurrentreads on the SGF content
+/// generated for the SGFCBenchmarkCorpusSpec objects in @a corpus and on the
+/// hand-written samples. Prints one line per SGF content to stderr. Returns
+/// @e YES if the check passes for all SGF content, @e NO if it fails for at
+/// least one SGF content.
++ (BOOL) verifyConcurrentReadsWithCorpus:(NSArray*)corpus;
+
+@end
@@ -0,0 +1,522 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarkCorpus.h"
+#import "SGFCBenchmarkVerifier.h"
+
+// SgfcKit includes
+#import <SGFCColorPropertyValue.h>
+#import <SGFCComposedPropertyValue.h>
+#import <SGFCDocument.h>
+#import <SGFCDocumentReader.h>
+#import <SGFCDocumentReadResult.h>
+#import <SGFCDocumentSnapshot.h>
+#import <SGFCDocumentWriter.h>
+#import <SGFCDoublePropertyValue.h>
+#import <SGFCGame.h>
+#import <SGFCGoMove.h>
+#import <SGFCGoMovePropertyValue.h>
+#import <SGFCGoPoint.h>
+#import <SGFCGoPointPropertyValue.h>
+#import <SGFCGoStone.h>
+#import <SGFCGoStonePropertyValue.h>
+#import <SGFCKitFactory.h>
+#import <SGFCMovePropertyValue.h>
+#import <SGFCNode.h>
+#import <SGFCNumberPropertyValue.h>
+#import <SGFCPointPropertyValue.h>
+#import <SGFCProperty.h>
+#import <SGFCRealPropertyValue.h>
+#import <SGFCSimpleTextPropertyValue.h>
+#import <SGFCSinglePropertyValue.h>
+#import <SGFCStonePropertyValue.h>
+#import <SGFCTextPropertyValue.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSData.h>
+#import <Foundation/NSString.h>
+#import <Foundation/NSValue.h>
+
+// C++ Standard Library includes
+#import <cstdio>
+#import <latch>
+#import <thread>
+#import <utility>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // The number of threads that read a frozen document at the same time in
+  // the check frozen.concurrentreads.
+  const NSUInteger NumberOfConcurrentReaderThreads = 32;
+
+  // Hand-written samples that cover features the synthetic corpus does not
+  // contain. The samples stay within the subset of SGF content that all
+  // read paths support.
+  NSArray* Samples()
+  {
+    return @[
+      // Escaped characters, soft and hard line breaks, composed values,
+      // markup and game info
+      @"(;FF[4]GM[1]CA[UTF-8]AP[Verifier:1.0]SZ[19]KM[6.5]HA[2]AB[dd][pp]"
+      @"PB[Black \\] player]PW[White\\\\player]RE[W+0.5]DT[2026-01-01]"
+      @"GC[Line one\nLine two]C[Soft\\\nline break and escaped \\] bracket]"
+      @";W[dp]C[Comment with a colon: here]N[Node name]"
+      @";B[pd]LB[pd:A][dp:label \\: with colon]TR[qq][rr]"
+      @";W[qc]MA[aa][bb]SQ[cc]CR[dd]AR[aa:bb]LN[cc:dd]BL[123.25]OB[5]"
+      @"(;B[qq]GB[2]TE[1])(;B[rr]DM[1]V[-3.5])(;B[]BM[2]))",
+      // Rectangular board, setup and move properties
+      @"(;FF[4]GM[1]CA[UTF-8]SZ[13:9]PL[W];W[ma]KO[]MN[3];AE[ma]AW[ai];B[bb]IT[])",
+      // Collection, figures and views
+      @"(;FF[4]GM[1]CA[UTF-8]SZ[9]FG[]PM[2];B[ee]FG[257:Figure title]VW[aa][bb];W[ff]DD[])"
+      @"(;FF[4]GM[1]CA[UTF-8]SZ[9];AW[cc]TW[aa][ab];B[dd]WL[30.5]OW[2])",
+      // Values whose typed value is parsed by the trusted read path, which
+      // then has the libsgfc++ factory build the raw value from the typed
+      // value: integral and fractional reals, doubles, colors, numbers, and
+      // simple text and text with soft and hard line breaks. Windows line
+      // endings are missing on purpose: The trusted read path leaves them
+      // to SGFC, so they would only exercise the fallback.
+      @"(;FF[4]GM[1]CA[UTF-8]SZ[19]KM[6]TM[300]PL[B]"
+      @"GN[Simple\\\ntext with a soft line break]EV[Simple\ntext with a hard line break]"
+      @"C[Trailing soft line break\\\n]"
+      @";B[aa]BL[0.125]OB[0]V[0]HO[1]C[Hard\nline break]"
+      @";W[]WL[-0.5]OW[10]GW[2]UC[1]C[Escaped \\\\ backslash, no line break])",
+    ];
+  }
+
+  SGFCDocumentReadResult* ReadWithSgfc(NSString* sgfContent)
+  {
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    return [reader readSgfContentFromString:sgfContent];
+  }
+
+  NSString* Write(SGFCDocument* document)
+  {
+    SGFCDocumentWriter* writer = [SGFCKitFactory documentWriter];
+    NSString* sgfContent = nil;
+    [writer writeSgfContent:document toString:&sgfContent];
+    return sgfContent;
+  }
+
+  NSString* DescribeGoPoint(SGFCGoPoint* goPoint)
+  {
+    return goPoint ? [goPoint positionInGoPointNotation:SGFCGoPointNotationSgf] : @"<no point>";
+  }
+
+  NSString* DescribeTypedValue(SGFCSinglePropertyValue* propertyValue)
+  {
+    if (! propertyValue.hasTypedValue)
+      return @"<untyped>";
+
+    switch (propertyValue.valueType)
+    {
+      case SGFCPropertyValueTypeNumber:
+        return [@([propertyValue toNumberValue].numberValue) description];
+      case SGFCPropertyValueTypeReal:
+        return [NSString stringWithFormat:@"%.17g", static_cast<double>([propertyValue toRealValue].realValue)];
+      case SGFCPropertyValueTypeDouble:
+        return [@([propertyValue toDoubleValue].doubleValue) description];
+      case SGFCPropertyValueTypeColor:
+        return [@([propertyValue toColorValue].colorValue) description];
+      case SGFCPropertyValueTypeSimpleText:
+        return [propertyValue toSimpleTextValue].simpleTextValue;
+      case SGFCPropertyValueTypeText:
+        return [propertyValue toTextValue].textValue;
+      case SGFCPropertyValueTypePoint:
+      {
+        SGFCPointPropertyValue* pointValue = [propertyValue toPointValue];
+        SGFCGoPointPropertyValue* goPointValue = [pointValue toGoPointValue];
+        if (goPointValue)
+          return [NSString stringWithFormat:@"%@ go:%@", pointValue.pointValue, DescribeGoPoint(goPointValue.goPoint)];
+        else
+          return pointValue.pointValue;
+      }
+      case SGFCPropertyValueTypeMove:
+      {
+        SGFCMovePropertyValue* moveValue = [propertyValue toMoveValue];
+        SGFCGoMovePropertyValue* goMoveValue = [moveValue toGoMoveValue];
+        if (! goMoveValue)
+          return moveValue.moveValue;
+        else if (goMoveValue.goMove.isPassMove)
+          return [NSString stringWithFormat:@"%@ go:pass color:%@", moveValue.moveValue, @(goMoveValue.goMove.playerColor)];
+        else
+          return [NSString stringWithFormat:@"%@ go:%@ color:%@", moveValue.moveValue, DescribeGoPoint(goMoveValue.goMove.stoneLocation), @(goMoveValue.goMove.playerColor)];
+      }
+      case SGFCPropertyValueTypeStone:
+      {
+        SGFCStonePropertyValue* stoneValue = [propertyValue toStoneValue];
+        SGFCGoStonePropertyValue* goStoneValue = [stoneValue toGoStoneValue];
+        if (goStoneValue)
+          return [NSString stringWithFormat:@"%@ go:%@ color:%@", stoneValue.stoneValue, DescribeGoPoint(goStoneValue.goStone.location), @(goStoneValue.goStone.color)];
+        else
+          return stoneValue.stoneValue;
+      }
+      default:
+        return @"<unknown>";
+    }
+  }
+
+  NSString* DescribeSinglePropertyValue(SGFCSinglePropertyValue* propertyValue)
+  {
+    return [NSString stringWithFormat:@"type %@, raw \"%@\", typed \"%@\"",
+            @(propertyValue.valueType),
+            propertyValue.rawValue,
+            DescribeTypedValue(propertyValue)];
+  }
+
+  NSString* DescribePropertyValue(id<SGFCPropertyValue> propertyValue)
+  {
+    if (propertyValue.isComposedValue)
+    {
+      SGFCComposedPropertyValue* composedValue = [propertyValue toComposedValue];
+      return [NSString stringWithFormat:@"composed(%@ | %@)",
+              DescribeSinglePropertyValue(composedValue.value1),
+              DescribeSinglePropertyValue(composedValue.value2)];
+    }
+    else
+    {
+      return DescribeSinglePropertyValue([propertyValue toSingleValue]);
+    }
+  }
+
+  NSString* DescribeNode(SGFCNode* node)
+  {
+    NSMutableString* description = [NSMutableString string];
+    for (SGFCProperty* property in node.properties)
+    {
+      [description appendString:property.propertyName];
+      for (id<SGFCPropertyValue> propertyValue in property.propertyValues)
+        [description appendFormat:@"[%@]", DescribePropertyValue(propertyValue)];
+      [description appendString:@"\n"];
+    }
+    return description;
+  }
+
+  // Returns a description of the entire object tree of @a document, in
+  // pre-order. Every property is also looked up by name, so that the lookup
+  // path of SGFCNode is exercised as well.
+  NSString* DescribeDocument(SGFCDocument* document)
+  {
+    NSMutableString* description = [NSMutableString string];
+
+    for (SGFCGame* game in document.games)
+    {
+      [description appendString:@"game\n"];
+
+      std::vector<SGFCNode*> nodes;
+      nodes.push_back(game.rootNode);
+
+      while (! nodes.empty())
+      {
+        SGFCNode* node = nodes.back();
+        nodes.pop_back();
+        if (node == nil)
+          continue;
+
+        [description appendString:DescribeNode(node)];
+        for (SGFCProperty* property in node.properties)
+        {
+          if ([node propertyWithName:property.propertyName] == nil)
+            [description appendFormat:@"lookup of %@ failed\n", property.propertyName];
+        }
+
+        NSArray* children = node.children;
+        [description appendFormat:@"%lu children\n", static_cast<unsigned long>(children.count)];
+        for (NSUInteger childIndex = children.count; childIndex > 0; childIndex--)
+          nodes.push_back(children[childIndex - 1]);
+      }
+    }
+
+    return description;
+  }
+
+  // Returns a description of the first difference between the object trees
+  // of @a expectedDocument and @a actualDocument, or nil if the object
+  // trees are the same.
+  NSString* FirstDifference(SGFCDocument* expectedDocument, SGFCDocument* actualDocument)
+  {
+    NSArray* expectedGames = expectedDocument.games;
+    NSArray* actualGames = actualDocument.games;
+    if (expectedGames.count != actualGames.count)
+      return [NSString stringWithFormat:@"%lu games instead of %lu", static_cast<unsigned long>(actualGames.count), static_cast<unsigned long>(expectedGames.count)];
+
+    for (NSUInteger gameIndex = 0; gameIndex < expectedGames.count; gameIndex++)
+    {
+      SGFCGame* expectedGame = expectedGames[gameIndex];
+      SGFCGame* actualGame = actualGames[gameIndex];
+
+      // Iterate instead of recursing, the corpus contains deep trees
+      std::vector<std::pair<SGFCNode*, SGFCNode*>> nodePairs;
+      nodePairs.push_back({ expectedGame.rootNode, actualGame.rootNode });
+      NSUInteger nodeNumber = 0;
+
+      while (! nodePairs.empty())
+      {
+        SGFCNode* expectedNode = nodePairs.back().first;
+        SGFCNode* actualNode = nodePairs.back().second;
+        nodePairs.pop_back();
+        nodeNumber++;
+
+        if ((expectedNode == nil) != (actualNode == nil))
+          return [NSString stringWithFormat:@"game %lu, node %lu: node is missing or unexpected", static_cast<unsigned long>(gameIndex + 1), static_cast<unsigned long>(nodeNumber)];
+        if (expectedNode == nil)
+          continue;
+
+        NSString* expectedDescription = DescribeNode(expectedNode);
+        NSString* actualDescription = DescribeNode(actualNode);
+        if (! [expectedDescription isEqualToString:actualDescription])
+        {
+          return [NSString stringWithFormat:@"game %lu, node %lu: expected\n%@but got\n%@",
+                  static_cast<unsigned long>(gameIndex + 1),
+                  static_cast<unsigned long>(nodeNumber),
+                  expectedDescription,
+                  actualDescription];
+        }
+
+        NSArray* expectedChildren = expectedNode.children;
+        NSArray* actualChildren = actualNode.children;
+        if (expectedChildren.count != actualChildren.count)
+        {
+          return [NSString stringWithFormat:@"game %lu, node %lu: %lu children instead of %lu",
+                  static_cast<unsigned long>(gameIndex + 1),
+                  static_cast<unsigned long>(nodeNumber),
+                  static_cast<unsigned long>(actualChildren.count),
+                  static_cast<unsigned long>(expectedChildren.count)];
+        }
+
+        // Push in reverse order so that the nodes are visited in pre-order
+        for (NSUInteger childIndex = expectedChildren.count; childIndex > 0; childIndex--)
+          nodePairs.push_back({ expectedChildren[childIndex - 1], actualChildren[childIndex - 1] });
+      }
+    }
+
+    return nil;
+  }
+
+  // Reads @a sgfContent once with SGFC and once with an SGFCDocumentReader
+  // that trusts its input. Returns a description of the first difference
+  // between the two object trees, or nil if the object trees are the same.
+  // @a sgfContent must have been normalized by SGFC.
+  NSString* FirstDifferenceBetweenReadPaths(NSString* sgfContent)
+  {
+    SGFCDocumentReadResult* expectedReadResult = ReadWithSgfc(sgfContent);
+    if (! expectedReadResult.isSgfDataValid)
+      return @"SGFC cannot read the normalized SGF content";
+
+    SGFCDocumentReader* trustingReader = [SGFCKitFactory documentReader];
+    trustingReader.trustsInput = YES;
+    SGFCDocumentReadResult* actualReadResult = [trustingReader readSgfContentFromString:sgfContent];
+    if (! actualReadResult.isTrustedInputResult)
+      return @"the read operation that trusts its input falls back to SGFC";
+
+    return FirstDifference(expectedReadResult.document, actualReadResult.document);
+  }
+
+  void PrintCheckLine(const char* checkName, NSString* inputName, NSString* failureReason)
+  {
+    if (failureReason)
+      fprintf(stderr, "FAIL %s %s: %s\n", checkName, [inputName UTF8String], [failureReason UTF8String]);
+    else
+      fprintf(stderr, "PASS %s %s\n", checkName, [inputName UTF8String]);
+  }
+}
+
+@implementation SGFCBenchmarkVerifier
+
+#pragma mark - Public API
+
++ (BOOL) verifyWithCorpus:(NSArray*)corpus
+{
+  NSMutableArray* inputNames = [NSMutableArray array];
+  NSMutableArray* inputs = [NSMutableArray array];
+  [self getInputNames:inputNames inputs:inputs withCorpus:corpus];
+
+  BOOL allChecksPassed = YES;
+
+  for (NSUInteger inputIndex = 0; inputIndex < inputs.count; inputIndex++)
+  {
+    @autoreleasepool
+    {
+      NSString* failureReason = [self failureOfSnapshotRoundTripWithSgfContent:inputs[inputIndex]];
+      PrintCheckLine("snapshot.roundtrip", inputNames[inputIndex], failureReason);
+      if (failureReason)
+        allChecksPassed = NO;
+
+      failureReason = [self failureOfTrustedReadWithSgfContent:inputs[inputIndex]];
+      PrintCheckLine("trusted.differential", inputNames[inputIndex], failureReason);
+      if (failureReason)
+        allChecksPassed = NO;
+    }
+  }
+
+  return allChecksPassed;
+}
+
++ (BOOL) verifyConcurrentReadsWithCorpus:(NSArray*)corpus
+{
+  NSMutableArray* inputNames = [NSMutableArray array];
+  NSMutableArray* inputs = [NSMutableArray array];
+  [self getInputNames:inputNames inputs:inputs withCorpus:corpus];
+
+  BOOL allChecksPassed = YES;
+
+  for (NSUInteger inputIndex = 0; inputIndex < inputs.count; inputIndex++)
+  {
+    @autoreleasepool
+    {
+      NSString* failureReason = [self failureOfConcurrentReadsWithSgfContent:inputs[inputIndex]];
+      PrintCheckLine("frozen.concurrentreads", inputNames[inputIndex], failureReason);
+      if (failureReason)
+        allChecksPassed = NO;
+    }
+  }
+
+  return allChecksPassed;
+}
+
+#pragma mark - Private API
+
+// Fills @a inputNames and @a inputs with the names and the SGF content of
+// the entries in @a corpus, followed by the hand-written samples.
++ (void) getInputNames:(NSMutableArray*)inputNames inputs:(NSMutableArray*)inputs withCorpus:(NSArray*)corpus
+{
+  for (SGFCBenchmarkCorpusSpec* spec in corpus)
+  {
+    [inputNames addObject:spec.name];
+    [inputs addObject:[SGFCBenchmarkCorpus sgfContentWithSpec:spec]];
+  }
+
+  NSArray* samples = Samples();
+  for (NSUInteger sampleIndex = 0; sampleIndex < samples.count; sampleIndex++)
+  {
+    [inputNames addObject:[NSString stringWithFormat:@"sample-%lu", static_cast<unsigned long>(sampleIndex + 1)]];
+    [inputs addObject:samples[sampleIndex]];
+  }
+}
+
+// Performs the check snapshot.roundtrip on @a sgfContent. Returns a
+// description why the check failed, or nil if the check passed.
++ (NSString*) failureOfSnapshotRoundTripWithSgfContent:(NSString*)sgfContent
+{
+  SGFCDocumentReadResult* readResult = ReadWithSgfc(sgfContent);
+  if (! readResult.isSgfDataValid)
+    return @"SGFC cannot read the SGF content";
+
+  SGFCDocument* document = readResult.document;
+  NSData* snapshotData = [SGFCKitFactory documentSnapshotWithDocument:document].snapshotData;
+  SGFCDocument* decodedDocument = [SGFCKitFactory documentSnapshotWithData:snapshotData].document;
+
+  NSString* difference = FirstDifference(document, decodedDocument);
+  if (difference)
+    return difference;
+
+  NSString* expectedSgfContent = Write(document);
+  NSString* actualSgfContent = Write(decodedDocument);
+  if (! expectedSgfContent || ! [expectedSgfContent isEqualToString:actualSgfContent])
+    return @"SGFCDocumentWriter generates different SGF content for the decoded document";
+
+  return nil;
+}
+
+// Performs the check trusted.differential on @a sgfContent. Returns a
+// description why the check failed, or nil if the check passed.
++ (NSString*) failureOfTrustedReadWithSgfContent:(NSString*)sgfContent
+{
+  SGFCDocumentReadResult* readResult = ReadWithSgfc(sgfContent);
+  if (! readResult.isSgfDataValid)
+    return @"SGFC cannot read the SGF content";
+
+  // A reader may bypass SGFC only for SGF content that SGFC has normalized
+  NSString* normalizedSgfContent = Write(readResult.document);
+  if (! normalizedSgfContent)
+    return @"SGFCDocumentWriter cannot write the document";
+
+  NSString* difference = FirstDifferenceBetweenReadPaths(normalizedSgfContent);
+  if (difference)
+    return difference;
+
+  // SGFC accepts the encoding name in any case, and SGFCDocumentReader
+  // replaces it with "UTF-8" in the root node. The trusted read path must
+  // do the same.
+  NSString* lowercaseEncodingSgfContent = [normalizedSgfContent stringByReplacingOccurrencesOfString:@"CA[UTF-8]"
+                                                                                          withString:@"CA[utf-8]"];
+  difference = FirstDifferenceBetweenReadPaths(lowercaseEncodingSgfContent);
+  if (difference)
+    return [@"with lowercase encoding name: " stringByAppendingString:difference];
+
+  return nil;
+}
+
+// Performs the check frozen.concurrentreads on @a sgfContent. Returns a
+// description why the check failed, or nil if the check passed.
++ (NSString*) failureOfConcurrentReadsWithSgfContent:(NSString*)sgfContent
+{
+  SGFCDocumentReadResult* readResult = ReadWithSgfc(sgfContent);
+  if (! readResult.isSgfDataValid)
+    return @"SGFC cannot read the SGF content";
+
+  NSString* expectedDescription = DescribeDocument(readResult.document);
+
+  // Read the content a second time so that none of the objects that are
+  // created on demand exist yet when the reader threads start. The first
+  // accesses then happen concurrently, which is what the check is about.
+  SGFCDocument* frozenDocument = ReadWithSgfc(sgfContent).document;
+  [frozenDocument freeze];
+
+  std::vector<NSString*> actualDescriptions(NumberOfConcurrentReaderThreads);
+  std::latch startSignal(NumberOfConcurrentReaderThreads);
+  std::vector<std::thread> readerThreads;
+
+  for (NSUInteger threadIndex = 0; threadIndex < NumberOfConcurrentReaderThreads; threadIndex++)
+  {
+    readerThreads.emplace_back([&, threadIndex]()
+    {
+      @autoreleasepool
+      {
+        startSignal.arrive_and_wait();
+
+        @try
+        {
+          actualDescriptions[threadIndex] = DescribeDocument(frozenDocument);
+        }
+        @catch (NSException* exception)
+        {
+          actualDescriptions[threadIndex] = [NSString stringWithFormat:@"exception %@: %@", exception.name, exception.reason];
+        }
+      }
+    });
+  }
+
+  for (auto& readerThread : readerThreads)
+    readerThread.join();
+
+  for (NSUInteger threadIndex = 0; threadIndex < NumberOfConcurrentReaderThreads; threadIndex++)
+  {
+    if (! [expectedDescription isEqualToString:actualDescriptions[threadIndex]])
+    {
+      return [NSString stringWithFormat:@"thread %lu sees a different object tree than the unfrozen document",
+              static_cast<unsigned long>(threadIndex + 1)];
+    }
+  }
+
+  return nil;
+}
+
+@end
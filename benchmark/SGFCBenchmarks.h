@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+
+/// @brief The SGFCBenchmarks class defines the benchmark cases that
+/// SgfcKit-benchmark runs.
+///
+/// All functions in SGFCBenchmarks are class methods, so there is no need
+/// to create an instance of SGFCBenchmarks.
+@interface SGFCBenchmarks : NSObject
+{
+}
+
+/// @brief Returns a collection of SGFCBenchmarkCase objects that together
+/// form the benchmark suite.
++ (NSArray*) allBenchmarkCases;
+
+@end
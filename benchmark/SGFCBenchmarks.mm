@@ -0,0 +1,500 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarks.h"
+#import "SGFCBenchmarkCorpus.h"
+#import "SGFCBenchmarkRunner.h"
+
+// SgfcKit includes
+#import <SGFCCommandLine.h>
+#import <SGFCArguments.h>
+#import <SGFCCompiledArguments.h>
+#import <SGFCConstants.h>
+#import <SGFCDocument.h>
+#import <SGFCDocumentReader.h>
+#import <SGFCDocumentReaderPool.h>
+#import <SGFCDocumentReadResult.h>
+#import <SGFCDocumentSnapshot.h>
+#import <SGFCDocumentValidator.h>
+#import <SGFCDocumentWriter.h>
+#import <SGFCGame.h>
+#import <SGFCKitFactory.h>
+#import <SGFCNode.h>
+#import <SGFCProperty.h>
+
+// SgfcKit internal includes. The benchmarks link against the static library
+// and therefore have access to the library-internal classes.
+#import "../src/interface/internal/SGFCDocumentInternalAdditions.h"
+#import "../src/SGFCMappingUtility.h"
+#import "../src/SGFCWrappingUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcPropertyValue.h>
+#import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSFileManager.h>
+#import <Foundation/NSPathUtilities.h>
+#import <Foundation/NSString.h>
+
+// C++ Standard Library includes
+#import <cstdio>
+#import <memory>
+#import <string>
+#import <vector>
+
+// The number of conversions performed by one iteration of the mapping
+// benchmarks
+static const NSUInteger numberOfMappingOperations = 100000;
+// The number of property values wrapped by one iteration of the wrapping
+// benchmark
+static const NSUInteger numberOfPropertyValuesToWrap = 1000000;
+
+#pragma mark - Helper classes
+
+// Holds libsgfc++ objects for the wrapping benchmark. Blocks cannot
+// capture a C++ container by reference, and the container is too large to
+// be copied into each block invocation.
+@interface SGFCBenchmarkPropertyValues : NSObject
+{
+@public
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>> propertyValues;
+}
+@end
+
+@implementation SGFCBenchmarkPropertyValues
+@end
+
+#pragma mark - Helper functions
+
+namespace
+{
+  SGFCDocument* ReadDocument(NSString* sgfContent)
+  {
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    return [reader readSgfContentFromString:sgfContent].document;
+  }
+
+  // Returns the arguments that the lint benchmarks pass to SGFC
+  SGFCArguments* LintArguments()
+  {
+    SGFCArguments* arguments = [SGFCKitFactory emptyArguments];
+    [arguments addArgumentWithType:SGFCArgumentTypeEnableRestrictiveChecking];
+    [arguments addArgumentWithType:SGFCArgumentTypeDeleteEmptyNodes];
+    [arguments addArgumentWithType:SGFCArgumentTypeDeleteObsoleteProperties];
+    return arguments;
+  }
+
+  // Performs the work of one lint request: Checks @a sgfContent and, if it
+  // is valid, returns the content that SGFC generates
+  void LintSgfContent(SGFCCommandLine* commandLine, NSString* sgfContent)
+  {
+    [commandLine loadSgfContentFromString:sgfContent];
+    (void)commandLine.firstCriticalMessage;
+    if (! commandLine.isSgfContentValid)
+      return;
+
+    // saveSgfContentToString:() insists on a non-nil initial value
+    NSString* lintedSgfContent = @"";
+    [commandLine saveSgfContentToString:&lintedSgfContent];
+  }
+
+  // Visits every node in @a document in depth-first order, without
+  // recursion
+  void VisitAllNodes(SGFCDocument* document, void (^visitor)(SGFCNode* node))
+  {
+    NSMutableArray* nodesToVisit = [NSMutableArray array];
+
+    for (SGFCGame* game in document.games)
+    {
+      SGFCNode* rootNode = game.rootNode;
+      if (rootNode)
+        [nodesToVisit addObject:rootNode];
+
+      while (nodesToVisit.count > 0)
+      {
+        SGFCNode* node = nodesToVisit.lastObject;
+        [nodesToVisit removeLastObject];
+
+        visitor(node);
+
+        // Every navigation property access creates a new wrapper object, so
+        // each relative is queried only once
+        SGFCNode* nextSibling = node.nextSibling;
+        if (nextSibling)
+          [nodesToVisit addObject:nextSibling];
+        SGFCNode* firstChild = node.firstChild;
+        if (firstChild)
+          [nodesToVisit addObject:firstChild];
+      }
+    }
+  }
+}
+
+@implementation SGFCBenchmarks
+
+#pragma mark - Public API
+
++ (NSArray*) allBenchmarkCases
+{
+  return @[
+    [self readFromStringBenchmarkCase],
+    [self readFromFileBenchmarkCase],
+    [self readWithPooledReaderBenchmarkCase],
+    [self readFromSnapshotBenchmarkCase],
+    [self readTrustedInputBenchmarkCase],
+    [self writeToStringBenchmarkCase],
+    [self commandLineRoundTripBenchmarkCase],
+    [self freshCommandLineLintBenchmarkCase],
+    [self reusedCommandLineLintBenchmarkCase],
+    [self nativeValidationBenchmarkCase],
+    [self incrementalValidationBenchmarkCase],
+    [self wrappedTraversalBenchmarkCase],
+    [self propertyLookupBenchmarkCase],
+    [self stringMappingBenchmarkCase],
+    [self enumMappingBenchmarkCase],
+    [self propertyValueWrappingBenchmarkCase],
+  ];
+}
+
+#pragma mark - Private API - Reading and writing
+
++ (SGFCBenchmarkCase*) readFromStringBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"read.string"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return sgfContent;
+  }
+                                runBlock:^(NSString* sgfContent)
+  {
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    SGFCDocumentReadResult* readResult = [reader readSgfContentFromString:sgfContent];
+    (void)readResult.document;
+  }];
+}
+
++ (SGFCBenchmarkCase*) readFromFileBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"read.file"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    NSString* fileName = [NSString stringWithFormat:@"SgfcKit-benchmark-%@.sgf", spec.name];
+    NSString* sgfFilePath = [NSTemporaryDirectory() stringByAppendingPathComponent:fileName];
+    [sgfContent writeToFile:sgfFilePath atomically:YES encoding:NSUTF8StringEncoding error:nil];
+    return sgfFilePath;
+  }
+                                runBlock:^(NSString* sgfFilePath)
+  {
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    SGFCDocumentReadResult* readResult = [reader readSgfContentFromFile:sgfFilePath];
+    (void)readResult.document;
+  }];
+}
+
+// Compare with read.string: the reader is acquired from a pool instead of
+// being created anew for every iteration
++ (SGFCBenchmarkCase*) readWithPooledReaderBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"read.pooled"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    SGFCCompiledArguments* compiledArguments = [SGFCKitFactory compiledArgumentsWithArguments:[SGFCKitFactory emptyArguments]];
+    SGFCDocumentReaderPool* readerPool = [SGFCKitFactory documentReaderPoolWithCompiledArguments:compiledArguments
+                                                                                 maximumPoolSize:1];
+    return @[readerPool, sgfContent];
+  }
+                                runBlock:^(NSArray* context)
+  {
+    SGFCDocumentReaderPool* readerPool = context[0];
+    [readerPool withReader:^(SGFCDocumentReader* reader)
+    {
+      SGFCDocumentReadResult* readResult = [reader readSgfContentFromString:context[1]];
+      (void)readResult.document;
+    }];
+  }];
+}
+
+// Compare with read.string: loading a snapshot skips SGFC parsing and
+// checking
++ (SGFCBenchmarkCase*) readFromSnapshotBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"read.snapshot"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    SGFCDocument* document = ReadDocument(sgfContent);
+    return [SGFCKitFactory documentSnapshotWithDocument:document].snapshotData;
+  }
+                                runBlock:^(NSData* snapshotData)
+  {
+    SGFCDocumentSnapshot* snapshot = [SGFCKitFactory documentSnapshotWithData:snapshotData];
+    (void)snapshot.document;
+  }];
+}
+
+// Compare with read.string: the SGF content is normalized by SGFC during
+// set up, so that the reader can bypass SGFC
++ (SGFCBenchmarkCase*) readTrustedInputBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"read.trusted"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    SGFCDocumentWriter* writer = [SGFCKitFactory documentWriter];
+    NSString* trustedSgfContent;
+    [writer writeSgfContent:ReadDocument(sgfContent) toString:&trustedSgfContent];
+
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    reader.trustsInput = YES;
+    if (! [reader readSgfContentFromString:trustedSgfContent].isTrustedInputResult)
+      fprintf(stderr, "read.trusted: Corpus %s falls back to SGFC\n", [spec.name UTF8String]);
+
+    return trustedSgfContent;
+  }
+                                runBlock:^(NSString* trustedSgfContent)
+  {
+    SGFCDocumentReader* reader = [SGFCKitFactory documentReader];
+    reader.trustsInput = YES;
+    SGFCDocumentReadResult* readResult = [reader readSgfContentFromString:trustedSgfContent];
+    (void)readResult.document;
+  }];
+}
+
++ (SGFCBenchmarkCase*) writeToStringBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"write.string"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return ReadDocument(sgfContent);
+  }
+                                runBlock:^(SGFCDocument* document)
+  {
+    SGFCDocumentWriter* writer = [SGFCKitFactory documentWriter];
+    NSString* sgfContent;
+    [writer writeSgfContent:document toString:&sgfContent];
+  }];
+}
+
++ (SGFCBenchmarkCase*) commandLineRoundTripBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"commandline.roundtrip"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return sgfContent;
+  }
+                                runBlock:^(NSString* sgfContent)
+  {
+    SGFCCommandLine* commandLine = [SGFCKitFactory commandLineWithNoArguments];
+    [commandLine loadSgfContentFromString:sgfContent];
+    // saveSgfContentToString:() insists on a non-nil initial value
+    NSString* savedSgfContent = @"";
+    [commandLine saveSgfContentToString:&savedSgfContent];
+  }];
+}
+
+// Simulates one request to a lint service that creates a new command line
+// for every request. Compare with commandline.lint.reused. The number of
+// requests per second is the inverse of the median duration.
++ (SGFCBenchmarkCase*) freshCommandLineLintBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"commandline.lint.fresh"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return sgfContent;
+  }
+                                runBlock:^(NSString* sgfContent)
+  {
+    SGFCCommandLine* commandLine = [SGFCKitFactory commandLineWithArguments:LintArguments()];
+    LintSgfContent(commandLine, sgfContent);
+  }];
+}
+
+// Simulates one request to a lint service that resets and reuses the same
+// command line for all requests
++ (SGFCBenchmarkCase*) reusedCommandLineLintBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"commandline.lint.reused"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return @[[SGFCKitFactory commandLineWithArguments:LintArguments()], sgfContent];
+  }
+                                runBlock:^(NSArray* context)
+  {
+    SGFCCommandLine* commandLine = context[0];
+    [commandLine reset];
+    LintSgfContent(commandLine, context[1]);
+  }];
+}
+
+#pragma mark - Private API - Validation
+
++ (SGFCBenchmarkCase*) nativeValidationBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"validate.native"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return @[[SGFCKitFactory documentValidator], ReadDocument(sgfContent)];
+  }
+                                runBlock:^(NSArray* context)
+  {
+    SGFCDocumentValidator* validator = context[0];
+    (void)[validator validateDocument:context[1]];
+  }];
+}
+
+// Compare with validate.native: every iteration simulates a single edit at
+// the end of the main variation of the first game, so that only the edited
+// node and its ancestors are checked again
++ (SGFCBenchmarkCase*) incrementalValidationBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"validate.incremental"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    SGFCGame* game = ReadDocument(sgfContent).games.firstObject;
+    // The first invocation fills the validation cache
+    (void)[game validateIncrementally];
+    SGFCNode* editedNode = game.rootNode.mainVariationNodes.lastObject;
+    return @[game, editedNode];
+  }
+                                runBlock:^(NSArray* context)
+  {
+    SGFCGame* game = context[0];
+    SGFCNode* editedNode = context[1];
+    editedNode.properties = editedNode.properties;
+    (void)[game validateIncrementally];
+  }];
+}
+
+#pragma mark - Private API - Object tree access
+
+// Every iteration wraps the same libsgfc++ document anew, so that the
+// wrapper objects cached by the previous iteration do not distort the result
++ (SGFCBenchmarkCase*) wrappedTraversalBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"traversal.wrapped"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    return ReadDocument(sgfContent);
+  }
+                                runBlock:^(SGFCDocument* document)
+  {
+    SGFCDocument* freshlyWrappedDocument = [SGFCWrappingUtility wrapDocument:[document wrappedDocument]];
+    VisitAllNodes(freshlyWrappedDocument, ^(SGFCNode* node)
+    {
+      for (SGFCProperty* property in node.properties)
+        (void)property.propertyValues;
+    });
+  }];
+}
+
+// The nodes are wrapped during set up, and their properties are wrapped by
+// the metrics iteration that precedes the measured iterations, so this
+// measures the lookup itself
++ (SGFCBenchmarkCase*) propertyLookupBenchmarkCase
+{
+  return [SGFCBenchmarkCase caseWithName:@"lookup.propertyWithType"
+                              setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    NSMutableArray* nodes = [NSMutableArray array];
+    VisitAllNodes(ReadDocument(sgfContent), ^(SGFCNode* node)
+    {
+      [nodes addObject:node];
+    });
+    return nodes;
+  }
+                                runBlock:^(NSArray* nodes)
+  {
+    for (SGFCNode* node in nodes)
+    {
+      (void)[node propertyWithType:SGFCPropertyTypeB];
+      (void)[node propertyWithType:SGFCPropertyTypeW];
+      (void)[node propertyWithType:SGFCPropertyTypeC];
+      (void)[node propertyWithType:SGFCPropertyTypeSZ];
+    }
+  }];
+}
+
+#pragma mark - Private API - Library internals
+
++ (SGFCBenchmarkCase*) stringMappingBenchmarkCase
+{
+  return [SGFCBenchmarkCase corpusIndependentCaseWithName:@"mapping.strings"
+                                               setUpBlock:nil
+                                                 runBlock:^(id context)
+  {
+    std::string wrappedString = "A moderately long comment text, typical for an SGF C property value.";
+    for (NSUInteger index = 0; index < numberOfMappingOperations; index++)
+    {
+      NSString* string = [SGFCMappingUtility toSgfcKitString:wrappedString];
+      wrappedString = [SGFCMappingUtility fromSgfcKitString:string];
+    }
+  }];
+}
+
++ (SGFCBenchmarkCase*) enumMappingBenchmarkCase
+{
+  return [SGFCBenchmarkCase corpusIndependentCaseWithName:@"mapping.enums"
+                                               setUpBlock:nil
+                                                 runBlock:^(id context)
+  {
+    for (NSUInteger index = 0; index < numberOfMappingOperations; index++)
+    {
+      SGFCPropertyType propertyType = (index % 2 == 0) ? SGFCPropertyTypeB : SGFCPropertyTypeW;
+      LibSgfcPlusPlus::SgfcPropertyType wrappedPropertyType = [SGFCMappingUtility fromSgfcKitPropertyType:propertyType];
+      (void)[SGFCMappingUtility toSgfcKitPropertyType:wrappedPropertyType];
+    }
+  }];
+}
+
+// A mix of the value types that are most common in real-world SGF data
++ (SGFCBenchmarkCase*) propertyValueWrappingBenchmarkCase
+{
+  return [SGFCBenchmarkCase corpusIndependentCaseWithName:@"wrapping.propertyValues-1M"
+                                               setUpBlock:^id(SGFCBenchmarkCorpusSpec* spec, NSString* sgfContent)
+  {
+    auto propertyValueFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory();
+    auto boardSize = [SGFCMappingUtility fromSgfcKitBoardSize:SGFCBoardSizeDefaultGo];
+
+    SGFCBenchmarkPropertyValues* context = [[SGFCBenchmarkPropertyValues alloc] init];
+    context->propertyValues.reserve(numberOfPropertyValuesToWrap);
+    for (NSUInteger index = 0; index < numberOfPropertyValuesToWrap; index++)
+    {
+      switch (index % 4)
+      {
+        case 0:
+        case 1:
+          context->propertyValues.push_back(propertyValueFactory->CreateGoPointPropertyValue("dd", boardSize));
+          break;
+        case 2:
+          context->propertyValues.push_back(propertyValueFactory->CreateTextPropertyValue("comment"));
+          break;
+        default:
+          context->propertyValues.push_back(propertyValueFactory->CreateNumberPropertyValue(static_cast<LibSgfcPlusPlus::SgfcNumber>(index)));
+          break;
+      }
+    }
+
+    return context;
+  }
+                                                 runBlock:^(SGFCBenchmarkPropertyValues* context)
+  {
+    (void)[SGFCWrappingUtility wrapPropertyValues:context->propertyValues];
+  }];
+}
+
+@end
@@ -0,0 +1,10 @@
+set (
+  SOURCES
+  main.mm
+  SGFCBenchmarkBudgets.mm
+  SGFCBenchmarkCorpus.mm
+  SGFCBenchmarkRunner.mm
+  SGFCBenchmarks.mm
+  SGFCBenchmarkVerifier.mm
+  ${SOURCES_LIST_FILE_NAME}
+)
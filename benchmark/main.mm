@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCBenchmarkBudgets.h"
+#import "SGFCBenchmarkCorpus.h"
+#import "SGFCBenchmarkRunner.h"
+#import "SGFCBenchmarks.h"
+#import "SGFCBenchmarkVerifier.h"
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSAutoreleasePool.h>
+#import <Foundation/NSString.h>
+
+// C++ Standard Library includes
+#import <cstdio>
+#import <cstdlib>
+#import <cstring>
+
+namespace
+{
+  void PrintUsage(const char* executableName)
+  {
+    fprintf(stderr,
+            "Usage: %s [--help] [--verify] [--verify-concurrent-reads] [--format json|csv] [--iterations N] [--filter TEXT] [--output FILE] [--check-budgets FILE]\n"
+            "\n"
+            "  --verify      Do not run benchmarks. Instead check that the alternative\n"
+            "                read and write paths produce the same object tree as SGFC,\n"
+            "                and exit with status 1 if a check fails.\n"
+            "  --verify-concurrent-reads\n"
+            "                Do not run benchmarks. Instead check that many threads can\n"
+            "                read a frozen document at the same time, and exit with\n"
+            "                status 1 if the check fails.\n"
+            "  --format      Output format. Default: json.\n"
+            "  --iterations  Number of measured iterations per benchmark. Default: 5.\n"
+            "                With 0 only the counters are collected.\n"
+            "  --filter      Run only benchmarks whose name contains TEXT.\n"
+            "  --output      Write the results to FILE instead of stdout.\n"
+            "  --check-budgets\n"
+            "                Check the results against the performance budgets in FILE\n"
+            "                and exit with status 1 if a budget is not met.\n",
+            executableName);
+  }
+}
+
+int main (int argc, const char* argv[])
+{
+  @autoreleasepool
+  {
+    SGFCBenchmarkRunner* runner = [[SGFCBenchmarkRunner alloc] init];
+    BOOL useCsvFormat = NO;
+    NSString* outputFilePath = nil;
+    NSString* budgetsFilePath = nil;
+    BOOL verify = NO;
+    BOOL verifyConcurrentReads = NO;
+
+    for (int argumentIndex = 1; argumentIndex < argc; argumentIndex++)
+    {
+      const char* argument = argv[argumentIndex];
+      const char* value = (argumentIndex + 1 < argc) ? argv[argumentIndex + 1] : nullptr;
+
+      if (strcmp(argument, "--help") == 0)
+      {
+        PrintUsage(argv[0]);
+        return 0;
+      }
+      else if (strcmp(argument, "--verify") == 0)
+      {
+        verify = YES;
+
+        // The option has no value
+        continue;
+      }
+      else if (strcmp(argument, "--verify-concurrent-reads") == 0)
+      {
+        verifyConcurrentReads = YES;
+
+        // The option has no value
+        continue;
+      }
+      else if (value && strcmp(argument, "--format") == 0 && (strcmp(value, "json") == 0 || strcmp(value, "csv") == 0))
+        useCsvFormat = (strcmp(value, "csv") == 0);
+      else if (value && strcmp(argument, "--iterations") == 0 && (atoi(value) > 0 || strcmp(value, "0") == 0))
+        runner.numberOfIterations = static_cast<NSUInteger>(atoi(value));
+      else if (value && strcmp(argument, "--filter") == 0)
+        runner.filter = [NSString stringWithUTF8String:value];
+      else if (value && strcmp(argument, "--output") == 0)
+        outputFilePath = [NSString stringWithUTF8String:value];
+      else if (value && strcmp(argument, "--check-budgets") == 0)
+        budgetsFilePath = [NSString stringWithUTF8String:value];
+      else
+      {
+        PrintUsage(argv[0]);
+        return 1;
+      }
+
+      // Skip the value
+      argumentIndex++;
+    }
+
+    if (verify)
+    {
+      BOOL allChecksPassed = [SGFCBenchmarkVerifier verifyWithCorpus:[SGFCBenchmarkCorpus standardCorpus]];
+      return allChecksPassed ? 0 : 1;
+    }
+
+    if (verifyConcurrentReads)
+    {
+      BOOL allChecksPassed = [SGFCBenchmarkVerifier verifyConcurrentReadsWithCorpus:[SGFCBenchmarkCorpus standardCorpus]];
+      return allChecksPassed ? 0 : 1;
+    }
+
+    NSArray* results = [runner runBenchmarkCases:[SGFCBenchmarks allBenchmarkCases]
+                                      withCorpus:[SGFCBenchmarkCorpus standardCorpus]];
+
+    NSString* output = useCsvFormat
+      ? [SGFCBenchmarkRunner csvStringWithResults:results]
+      : [SGFCBenchmarkRunner jsonStringWithResults:results];
+
+    if (outputFilePath)
+    {
+      BOOL success = [output writeToFile:outputFilePath atomically:YES encoding:NSUTF8StringEncoding error:nil];
+      if (! success)
+      {
+        fprintf(stderr, "Failed to write results to %s\n", [outputFilePath UTF8String]);
+        return 1;
+      }
+    }
+    else
+    {
+      printf("%s\n", [output UTF8String]);
+    }
+
+    if (budgetsFilePath)
+    {
+      BOOL allBudgetsMet = [SGFCBenchmarkBudgets checkResults:results againstBudgetsInFile:budgetsFilePath];
+      if (! allBudgetsMet)
+        return 1;
+    }
+  }
+
+  return 0;
+}
@@ -18,6 +18,8 @@
 
 // Project includes
 #import "SGFCExitCode.h"
+#import "SGFCMessage.h"
+#import "SGFCMessageType.h"
 
 // System includes
 #import <Foundation/NSObject.h>
@@ -26,6 +28,7 @@
 @class NSArray;
 @class NSString;
 @class SGFCArguments;
+@class SGFCCompiledArguments;
 @class SGFCMessage;
 
 /// @brief The SGFCCommandLine interface is used to operate the SGFC backend
@@ -61,6 +64,28 @@
 /// - It may not save SGF content that was found to be invalid during loading,
 ///   or save SGF content without prior loading any content. Use
 ///   isSgfContentValid() to check this.
+///
+/// A client that processes many pieces of SGF content with the same SGFC
+/// command line arguments can use a single SGFCCommandLine object for all of
+/// them, invoking reset() between the load/save cycles. This avoids copying
+/// and wrapping the arguments for every cycle. The following guarantees
+/// apply to the state that is kept between cycles:
+/// - The SGFC command line arguments, the result of validating them and
+///   messageHandler() are kept for the lifetime of the object. reset() does
+///   not change them.
+/// - A load operation replaces the SGF content, the result of validating it
+///   and the parse result of the previous load operation.
+/// - A save operation replaces the save result of the previous save
+///   operation. A load operation does not change the save result.
+/// - After reset() the object behaves as if no SGF content had been loaded
+///   and saved yet: isSgfContentValid() returns NO, parseResult() and
+///   saveResult() return empty collections, and saving raises an exception.
+/// - SGFCMessage objects obtained before reset() or before a load/save
+///   operation remain valid, but are not part of the new results.
+///
+/// @note SGFC itself keeps no state between load operations. The SGFC
+/// backend is initialized anew for every load operation, regardless of
+/// whether the SGFCCommandLine object is reused or not.
 @interface SGFCCommandLine : NSObject
 {
 }
@@ -79,6 +104,13 @@
 /// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
 + (instancetype) commandLineWithArguments:(SGFCArguments*)arguments;
 
+/// @brief Returns a newly constructed SGFCCommandLine object that passes
+/// the command line arguments in @a compiledArguments to SGFC.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (instancetype) commandLineWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Returns a newly constructed SGFCCommandLine object that passes
 /// no command line arguments to SGFC.
 + (instancetype) commandLineWithNoArguments;
@@ -97,6 +129,18 @@
 /// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
 - (instancetype) initWithArguments:(SGFCArguments*)arguments;
 
+/// @brief Initializes an SGFCCommandLine object that passes
+/// the command line arguments in @a compiledArguments to SGFC.
+///
+/// Because the arguments in @a compiledArguments are known to be valid,
+/// isCommandLineValid() returns YES for the resulting object. arguments()
+/// returns the same SGFCArgument objects as
+/// SGFCCompiledArguments::arguments().
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Initializes an SGFCCommandLine object that passes
 /// no command line arguments to SGFC.
 ///
@@ -157,7 +201,8 @@
 /// @brief Returns YES if the SGF content that was loaded and parsed by the
 /// most recent invocation of either loadSgfContentFromFile:() or
 /// loadSgfContentFromString:() is valid. Returns NO if the SGF content is not
-/// valid, or if none of the methods have been invoked yet.
+/// valid, or if none of the methods have been invoked yet or since the most
+/// recent invocation of reset().
 ///
 /// The SGF content is considered valid if loadSgfContentFromFile:() or
 /// loadSgfContentFromString:() have been invoked at least once, and if their
@@ -169,12 +214,29 @@
 /// returns NO.
 @property(nonatomic, readonly, getter=isSgfContentValid) BOOL sgfContentValid;
 
+/// @brief A block that is invoked once for each message of a load or save
+/// operation, before the operation returns. The default is @e nil.
+///
+/// If the block sets its @e stop parameter to YES, the block is not invoked
+/// for the remaining messages of the operation. parseResult() and
+/// saveResult() always contain all messages.
+///
+/// The SGFCMessage objects passed to the block are not the same objects
+/// as the ones in the collections returned by parseResult() and
+/// saveResult().
+///
+/// @note The SGFC backend reports messages only after it has completed the
+/// operation, so the block is invoked after the SGF content has been loaded
+/// or saved.
+@property(nonatomic, copy) SGFCMessageHandler messageHandler;
+
 /// @brief Returns a collection of SGFCMessage objects which together form
 /// the parse result from the most recent invocation of either
 /// loadSgfContentFromFile:() or loadSgfContentFromString:().
 ///
-/// The collection is empty if none of the methods have been invoked yet, or
-/// if the most recent load operation did not generate any messages.
+/// The collection is empty if none of the methods have been invoked yet or
+/// since the most recent invocation of reset(), or if the most recent load
+/// operation did not generate any messages.
 ///
 /// If the collection is not empty, the messages appear in the order in
 /// which they were generated by SGFC.
@@ -183,6 +245,43 @@
 /// returns NO.
 @property(nonatomic, strong, readonly) NSArray* parseResult;
 
+/// @brief Returns the number of messages in the collection that
+/// parseResult() returns whose message type is @a messageType.
+///
+/// Unlike parseResult() this does not create any SGFCMessage objects.
+///
+/// @exception SGFCInvalidOperationException Is raised if isCommandLineValid()
+/// returns NO.
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType;
+
+/// @brief Returns a collection of SGFCMessage objects with the first
+/// @a limit messages in the collection that parseResult() returns whose
+/// message type is @a messageType. The messages appear in the order in which
+/// they were generated by SGFC. Pass @e NSUIntegerMax as @a limit to get all
+/// messages with the specified type.
+///
+/// Unlike parseResult() this creates SGFCMessage objects only for the
+/// returned messages. If parseResult() has already been accessed, the
+/// returned objects are the same as the ones in that collection.
+///
+/// @exception SGFCInvalidOperationException Is raised if isCommandLineValid()
+/// returns NO.
+- (NSArray*) messagesWithType:(SGFCMessageType)messageType limit:(NSUInteger)limit;
+
+/// @brief Returns the first message in the collection that parseResult()
+/// returns that is a critical message. Returns @e nil if there is no
+/// critical message.
+///
+/// Unlike parseResult() this creates an SGFCMessage object only for the
+/// returned message. If parseResult() has already been accessed, the
+/// returned object is the same as the one in that collection.
+///
+/// @see SGFCMessage::isCriticalMessage()
+///
+/// @exception SGFCInvalidOperationException Is raised if isCommandLineValid()
+/// returns NO.
+@property(nonatomic, strong, readonly) SGFCMessage* firstCriticalMessage;
+
 /// @brief Saves the SGF content generated by SGFC after the most recent
 /// invocation of either loadSgfContentFromFile:() or
 /// loadSgfContentFromString:() to the .sgf file at the specified path. This
@@ -194,7 +293,8 @@
 /// exit codes of SGFC.
 ///
 /// @exception SGFCInvalidOperationException Is raised if isSgfContentValid()
-/// returns NO.
+/// returns NO, or if reset() was invoked and no SGF content has been loaded
+/// since then.
 /// @exception NSInvalidArgumentException Is raised if @a sgfFilePath is @e nil.
 - (SGFCExitCode) saveSgfContentToFile:(NSString*)sgfFilePath;
 
@@ -208,7 +308,8 @@
 /// exit codes of SGFC.
 ///
 /// @exception SGFCInvalidOperationException Is raised if isSgfContentValid()
-/// returns NO.
+/// returns NO, or if reset() was invoked and no SGF content has been loaded
+/// since then.
 /// @exception NSInvalidArgumentException Is raised if dereferencing
 /// @a sgfContent is @e nil.
 - (SGFCExitCode) saveSgfContentToString:(out NSString**)sgfContent;
@@ -217,8 +318,9 @@
 /// the result from the most recent invocation of either saveSgfContentToFile:()
 /// or saveSgfContentToString:().
 ///
-/// The collection is empty if none of the methods have been invoked yet, or
-/// if the most recent save operation did not generate any messages.
+/// The collection is empty if none of the methods have been invoked yet or
+/// since the most recent invocation of reset(), or if the most recent save
+/// operation did not generate any messages.
 ///
 /// If the collection is not empty, the messages appear in the order in
 /// which they were generated by SGFC.
@@ -227,4 +329,16 @@
 /// returns NO.
 @property(nonatomic, strong, readonly) NSArray* saveResult;
 
+/// @brief Discards the SGF content and the results of the most recent load
+/// and save operations, so that the SGFCCommandLine object can be reused
+/// for a new load/save cycle with the same SGFC command line arguments.
+///
+/// After this method returns, isSgfContentValid() returns NO, parseResult()
+/// and saveResult() return empty collections, and saveSgfContentToFile:()
+/// and saveSgfContentToString:() raise an exception until SGF content is
+/// loaded again.
+///
+/// Invoking this method has no effect if isCommandLineValid() returns NO.
+- (void) reset;
+
 @end
@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+@class SGFCArguments;
+@class SGFCMessage;
+
+/// @brief The SGFCCompiledArguments class represents an immutable
+/// collection of arguments that has been validated once and that can be
+/// used to construct any number of SGFCDocumentReader, SGFCDocumentWriter
+/// and SGFCCommandLine objects. Use SGFCKitFactory to construct new
+/// SGFCCompiledArguments objects.
+///
+/// @ingroup public-api
+/// @ingroup sgfc-arguments
+///
+/// SGFCCompiledArguments is useful for clients that perform a large number
+/// of read, write or command line operations with a small number of
+/// argument profiles. Instead of populating the SGFCArguments object of
+/// every SGFCDocumentReader or SGFCDocumentWriter anew, the client compiles
+/// each argument profile once and passes the resulting
+/// SGFCCompiledArguments object to the factory methods that accept it.
+///
+/// When an SGFCCompiledArguments object is constructed, the arguments are
+/// validated by passing them to SGFC in the same way as SGFCCommandLine
+/// does. This detects e.g. illegal parameter values. Invoke isValid() to
+/// find out whether the arguments are valid.
+///
+/// An SGFCCompiledArguments object cannot be changed after construction.
+/// It can therefore be shared across any number of objects and threads.
+@interface SGFCCompiledArguments : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCCompiledArguments object that
+/// contains a copy of the arguments in @a arguments.
+///
+/// @note The content of @a arguments is copied, so if you change the
+/// content it will not affect the SGFCCompiledArguments object returned from
+/// this method.
+///
+/// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
++ (instancetype) compiledArgumentsWithArguments:(SGFCArguments*)arguments;
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Initializes an SGFCCompiledArguments object that contains a copy
+/// of the arguments in @a arguments.
+///
+/// This is the designated initializer of SGFCCompiledArguments.
+///
+/// @note The content of @a arguments is copied, so if you change the
+/// content it will not affect the SGFCCompiledArguments object.
+///
+/// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
+- (instancetype) initWithArguments:(SGFCArguments*)arguments NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the arguments that the SGFCCompiledArguments object
+/// consists of. The collection that is returned consists of SGFCArgument
+/// objects, in the order in which they were added to the SGFCArguments
+/// object from which the SGFCCompiledArguments object was constructed.
+@property(nonatomic, strong, readonly) NSArray* arguments;
+
+/// @brief Returns YES if the arguments that arguments() returns are valid.
+/// Returns NO if they are not valid.
+@property(nonatomic, readonly, getter=isValid) BOOL valid;
+
+/// @brief Returns an SGFCMessage object with message type
+/// #SGFCMessageTypeFatalError that describes why the arguments that
+/// arguments() returns are not valid. Returns @e nil if isValid() returns
+/// YES.
+@property(nonatomic, strong, readonly) SGFCMessage* invalidReason;
+
+@end
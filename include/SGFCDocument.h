@@ -29,7 +29,16 @@
 ///
 /// @ingroup public-api
 /// @ingroup document
-@interface SGFCDocument : NSObject
+///
+/// SGFCDocument adopts the NSCopying protocol. Invoking @e copy returns a deep
+/// copy of the document that contains a copy of each game. The games are
+/// copied in the same way as SGFCGame copies itself. Copying a document is
+/// much faster than writing it with SGFCDocumentWriter and reading the result
+/// with SGFCDocumentReader, because the copy is made directly from the
+/// in-memory game trees and does not run through SGFC. The copy is never
+/// frozen, so copying a frozen document is the way to get a modifiable
+/// version of it.
+@interface SGFCDocument : NSObject <NSCopying>
 {
 }
 
@@ -71,6 +80,8 @@
 /// @exception NSInvalidArgumentException Is raised if the property is set with
 /// a @e nil value, or if the property is set with a collection that contains
 /// @e nil values or duplicates.
+/// @exception SGFCInvalidOperationException Is raised if the property is set
+/// while the document is frozen.
 @property(nonatomic, strong) NSArray* games;
 
 /// @brief Returns the first game from the collection of games that
@@ -86,6 +97,8 @@
 ///
 /// @exception NSInvalidArgumentException Is raised if @a game is @e nil or
 /// if @a game is already in the collection.
+/// @exception SGFCInvalidOperationException Is raised if the document is
+/// frozen.
 - (void) appendGame:(SGFCGame*)game;
 
 /// @brief Removes @a game from the collection of games that together make
@@ -93,12 +106,62 @@
 ///
 /// @exception NSInvalidArgumentException Is raised if @a game is not part of
 /// the collection of games that together make up the document.
+/// @exception SGFCInvalidOperationException Is raised if the document is
+/// frozen.
 - (void) removeGame:(SGFCGame*)game;
 
 /// @brief Removes all games from the collection of games that together make
 /// up the document.
+///
+/// @exception SGFCInvalidOperationException Is raised if the document is
+/// frozen.
 - (void) removeAllGames;
 
+/// @brief Makes the document immutable so that it can be read concurrently
+/// from multiple threads. Freezing is irreversible. Does nothing if the
+/// document is already frozen.
+///
+/// Freezing also freezes the SGFCGame objects in games(), their root nodes
+/// and the root nodes' SGFCProperty objects. SGFCNode and SGFCProperty
+/// objects that are obtained from a frozen object (e.g. by navigating the
+/// game tree) are frozen as well. Any attempt to modify a frozen object
+/// raises an SGFCInvalidOperationException. Property values are immutable
+/// anyway.
+///
+/// Objects that wrap parts of the document but that were obtained before
+/// freeze() was invoked, and that are not reachable from games(), are @b not
+/// frozen. Do not modify the document through such objects after freeze()
+/// has been invoked.
+///
+/// Invoke freeze() before the document is handed over to other threads.
+/// After that, reading the document and the objects obtained from it is
+/// thread-safe. This includes the first access of values that are created
+/// on demand.
+- (void) freeze;
+
+/// @brief Returns YES if freeze() has been invoked. Returns NO if freeze()
+/// has not been invoked.
+@property(nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
+/// @brief Returns YES if the object graph of the document is released on a
+/// low-priority background thread when the document is deallocated. Returns
+/// NO if the object graph is released on the thread that deallocates the
+/// document. The default is NO.
+///
+/// Releasing a large document releases every SGFCGame, SGFCNode,
+/// SGFCProperty and property value object that was created for the
+/// document, as well as the entire libsgfc++ object tree. For documents
+/// that contain many or large games this can take a considerable amount of
+/// time. Set this property to YES to move that work off the thread that
+/// drops the last reference to the document. Objects that are still
+/// referenced elsewhere when the document is deallocated are not affected.
+///
+/// The background thread processes documents one after the other. If
+/// SGFCKitMetrics is enabled, the time between the deallocation of a
+/// document and the completion of the release is recorded as the
+/// reclamation lag.
+@property(nonatomic, assign) BOOL reclaimsMemoryInBackground;
+
 /// @brief Prints the content of the SGFCDocument to stdout for debugging
 /// purposes.
 - (void) debugPrintToConsole;
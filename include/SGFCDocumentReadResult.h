@@ -18,12 +18,15 @@
 
 // Project includes
 #import "SGFCExitCode.h"
+#import "SGFCMessageType.h"
 
 // System includes
 #import <Foundation/NSObject.h>
 
 // Forward declarations
 @class SGFCDocument;
+@class SGFCDocumentReadStatistics;
+@class SGFCMessage;
 
 /// @brief The SGFCDocumentReadResult class provides access to the result
 /// of a read operation performed by SGFCDocumentReader.
@@ -68,11 +71,74 @@
 /// read operation did not generate any messages.
 @property(nonatomic, strong, readonly) NSArray* parseResult;
 
+/// @brief Returns the number of messages in the collection that
+/// parseResult() returns whose message type is @a messageType.
+///
+/// Unlike parseResult() this does not create any SGFCMessage objects.
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType;
+
+/// @brief Returns a collection of SGFCMessage objects with the first
+/// @a limit messages in the collection that parseResult() returns whose
+/// message type is @a messageType. The messages appear in the order in which
+/// they were generated by SGFC. Pass @e NSUIntegerMax as @a limit to get all
+/// messages with the specified type.
+///
+/// Unlike parseResult() this creates SGFCMessage objects only for the
+/// returned messages. If parseResult() has already been accessed, the
+/// returned objects are the same as the ones in that collection.
+- (NSArray*) messagesWithType:(SGFCMessageType)messageType limit:(NSUInteger)limit;
+
+/// @brief Returns the first message in the collection that parseResult()
+/// returns that is a critical message. Returns @e nil if there is no
+/// critical message.
+///
+/// Unlike parseResult() this creates an SGFCMessage object only for the
+/// returned message. If parseResult() has already been accessed, the
+/// returned object is the same as the one in that collection.
+///
+/// @see SGFCMessage::isCriticalMessage()
+@property(nonatomic, strong, readonly) SGFCMessage* firstCriticalMessage;
+
 /// @brief Returns the document object that provides access to the SGF data
 /// in structured form. If isSgfDataValid() returns NO the document
 /// object that is returned contains no data.
 @property(nonatomic, strong, readonly) SGFCDocument* document;
 
+/// @brief Returns YES if the read operation was cut short because
+/// SGFCDocumentReader was configured to fail fast, or because the
+/// SGFCDocumentReader message handler requested to stop. Returns NO if the
+/// read operation was not cut short.
+///
+/// If this returns YES, parseResult() contains only the messages up to and
+/// including the message that caused the read operation to fail, and
+/// document() returns an empty document.
+///
+/// @see SGFCDocumentReader::failsFast()
+/// @see SGFCDocumentReader::messageHandler()
+@property(nonatomic, readonly, getter=isTruncated) BOOL truncated;
+
+/// @brief Returns YES if the read operation bypassed SGFC because
+/// SGFCDocumentReader was configured to trust its input, and the input was
+/// suitable for this. Returns NO if the read operation passed the SGF data
+/// through SGFC.
+///
+/// If this returns YES, exitCode() returns #SGFCExitCodeOk,
+/// isSgfDataValid() returns YES and parseResult() is empty.
+///
+/// @see SGFCDocumentReader::trustsInput()
+@property(nonatomic, readonly, getter=isTrustedInputResult) BOOL trustedInputResult;
+
+/// @brief Returns an object that provides statistics about the read
+/// operation and about the shape of the document that the read operation
+/// produced.
+///
+/// If isTruncated() returns YES, the statistics describe the truncated
+/// parse result and the empty document.
+///
+/// The statistics are determined the first time this property is accessed.
+/// Subsequent accesses return the same object.
+@property(nonatomic, strong, readonly) SGFCDocumentReadStatistics* statistics;
+
 /// @brief Prints the content of the SGFCDocumentReadResult to stdout for
 /// debugging purposes.
 - (void) debugPrintToConsole;
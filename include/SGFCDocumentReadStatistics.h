@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "SGFCMessageType.h"
+
+// System includes
+#import <Foundation/NSDate.h>
+#import <Foundation/NSObject.h>
+
+/// @brief The SGFCDocumentReadStatistics class provides statistics about a
+/// read operation performed by SGFCDocumentReader, and about the shape of
+/// the document that the read operation produced.
+///
+/// @ingroup public-api
+/// @ingroup sgfc-frontend
+/// @ingroup document
+///
+/// SGFCDocumentReadStatistics is immutable, i.e. once the
+/// SGFCDocumentReadStatistics object is constructed it cannot be changed.
+///
+/// The counts are obtained directly from the libsgfc++ document tree, so
+/// no SgfcKit wrapper objects are created to determine them. The counts
+/// reflect the state of the document at the time the statistics were
+/// first requested from SGFCDocumentReadResult.
+///
+/// Do @b NOT attempt to create an SGFCDocumentReadStatistics object
+/// yourself, instead always use the SGFCDocumentReadStatistics object
+/// returned by SGFCDocumentReadResult::statistics().
+@interface SGFCDocumentReadStatistics : NSObject
+{
+}
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Returns the time that the read operation took. This includes
+/// SGFC parsing the SGF data, SGFC checking the SGF data, and libsgfc++
+/// building the document tree. libsgfc++ performs these steps in a single
+/// call, so they cannot be measured individually.
+@property(nonatomic, readonly) NSTimeInterval readDuration;
+
+/// @brief Returns the number of bytes of SGF data that the read operation
+/// read. If the SGF data was read from a string, the number of bytes is the
+/// length of the string's UTF-8 representation.
+@property(nonatomic, readonly) unsigned long long inputByteCount;
+
+/// @brief Returns the number of games in the document.
+@property(nonatomic, readonly) NSUInteger gameCount;
+
+/// @brief Returns the number of nodes in all games of the document.
+@property(nonatomic, readonly) NSUInteger nodeCount;
+
+/// @brief Returns the number of properties in all nodes of the document.
+@property(nonatomic, readonly) NSUInteger propertyCount;
+
+/// @brief Returns the number of property values in all properties of the
+/// document.
+@property(nonatomic, readonly) NSUInteger propertyValueCount;
+
+/// @brief Returns the number of nodes on the longest path from the root
+/// node of a game to a leaf node, for the game in the document that has
+/// the longest such path. Returns 0 if the document contains no nodes.
+@property(nonatomic, readonly) NSUInteger maximumDepth;
+
+/// @brief Returns the number of variations in all games of the document.
+///
+/// Every node that is not the first child of its parent node starts a
+/// variation. A game without branches therefore has no variations.
+@property(nonatomic, readonly) NSUInteger variationCount;
+
+/// @brief Returns the number of messages with message type @a messageType
+/// that the read operation generated.
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType;
+
+@end
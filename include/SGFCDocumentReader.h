@@ -16,12 +16,16 @@
 
 #pragma once
 
+// Project includes
+#import "SGFCMessage.h"
+
 // System includes
 #import <Foundation/NSObject.h>
 
 // Forward declarations
 @class NSString;
 @class SGFCArguments;
+@class SGFCCompiledArguments;
 @class SGFCDocumentReadResult;
 
 /// @brief The SGFCDocumentReader interface provides functions to generate
@@ -70,11 +74,31 @@
 /// @brief Returns a newly constructed SGFCDocumentReader object.
 + (instancetype) documentReader;
 
+/// @brief Returns a newly constructed SGFCDocumentReader object whose
+/// collection of arguments initially contains the arguments in
+/// @a compiledArguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (instancetype) documentReaderWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Initializes an SGFCDocumentReader object.
 ///
 /// This is the designated initializer of SGFCArguments.
 - (instancetype) init NS_DESIGNATED_INITIALIZER;
 
+/// @brief Initializes an SGFCDocumentReader object whose collection of
+/// arguments initially contains the arguments in @a compiledArguments.
+///
+/// Unlike adding the same arguments to the collection that arguments()
+/// returns, this does not create wrapper objects for the arguments and does
+/// not convert argument values. Changes to the collection that arguments()
+/// returns do not affect @a compiledArguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Returns an object with the collection of arguments that
 /// SGFCDocumentReader passes on to SGFC whenever it performs a read
 /// operation.
@@ -85,6 +109,75 @@
 /// operations use the same arguments.
 @property(nonatomic, strong, readonly) SGFCArguments* arguments;
 
+/// @brief Returns YES if read operations fail fast on the first message of
+/// type #SGFCMessageTypeFatalError. Returns NO if read operations do not
+/// fail fast. The default is NO.
+///
+/// A read operation that fails fast returns an SGFCDocumentReadResult
+/// object whose parse result ends with the first message that caused the
+/// read operation to fail, and whose document is empty. Use this e.g. for
+/// validating uploaded files when only the first error matters, to avoid
+/// wrapping a document and a large number of messages that are not going to
+/// be used.
+///
+/// @note The SGFC backend has no way to abort a read operation once it has
+/// started, so SGF data is always parsed and checked in its entirety. What
+/// fails fast is the processing of the result in SgfcKit.
+///
+/// @see SGFCDocumentReadResult::isTruncated()
+@property(nonatomic, assign) BOOL failsFast;
+
+/// @brief Returns YES if read operations fail fast on the first message of
+/// type #SGFCMessageTypeError or #SGFCMessageTypeFatalError, regardless of
+/// the value of failsFast(). Returns NO if read operations do not fail fast
+/// on messages of type #SGFCMessageTypeError. The default is NO.
+@property(nonatomic, assign) BOOL failsFastOnErrors;
+
+/// @brief A block that is invoked once for each message of a read
+/// operation, before the read operation returns its result. The default is
+/// @e nil.
+///
+/// If the read operation fails fast (see failsFast()), the block is not
+/// invoked for the messages after the message that caused the read
+/// operation to fail. If the block sets its @e stop parameter to YES, the
+/// read operation stops as if it had failed fast on the message that was
+/// passed to the block: The SGFCDocumentReadResult object's parse result
+/// ends with that message, and its document is empty.
+///
+/// The SGFCMessage objects passed to the block are not the same objects
+/// as the ones in the SGFCDocumentReadResult object's parse result.
+///
+/// @note The SGFC backend reports messages only after it has processed the
+/// SGF data in its entirety, so the block is invoked after the SGF data has
+/// been processed, but before SgfcKit wraps the messages and the document.
+@property(nonatomic, copy) SGFCMessageHandler messageHandler;
+
+/// @brief Returns YES if the library client vouches that the SGF data it
+/// reads has already been normalized by SGFC, so that read operations may
+/// bypass SGFC. Returns NO if read operations always pass the SGF data
+/// through SGFC. The default is NO.
+///
+/// Use this e.g. for re-reading SGF data that the app itself has previously
+/// written with SGFCDocumentWriter, where passing the data through SGFC
+/// again would only repeat checks that have already been made.
+///
+/// A read operation bypasses SGFC only if the collection of arguments that
+/// arguments() returns is empty, and only if the SGF data is in the subset
+/// of SGF data that SgfcKit can parse natively: All games must be Go games
+/// in file format FF4 with the CA property value "UTF-8", all properties
+/// must be standard FF4 properties for Go, and all property values must
+/// have the format that SGFC generates. If one of these conditions is not
+/// met, the read operation transparently falls back to SGFC.
+///
+/// A read operation that bypasses SGFC does not check the SGF data beyond
+/// what is necessary to parse it, and it produces no messages. Passing SGF
+/// data that SGFC would have changed, e.g. because it contains a move and
+/// setup properties in the same node, results in a document that differs
+/// from the document that SGFC would have produced.
+///
+/// @see SGFCDocumentReadResult::isTrustedInputResult()
+@property(nonatomic, assign) BOOL trustsInput;
+
 /// @brief Reads SGF data from a single .sgf file located at the specified
 /// path and puts the data through the SGFC parser, using the arguments that
 /// arguments() currently returns.
@@ -105,4 +198,16 @@
 /// the read operation.
 - (SGFCDocumentReadResult*) readSgfContentFromString:(NSString*)sgfContent;
 
+/// @brief Restores the state that the SGFCDocumentReader object had
+/// immediately after it was initialized, so that it can be reused by a
+/// different client.
+///
+/// The collection of arguments is restored to its initial content, i.e.
+/// either empty or containing the arguments of the SGFCCompiledArguments
+/// object that was used for initialization. The SGFCArguments object that
+/// arguments() returned before this method was invoked no longer has any
+/// effect on read operations. failsFast(), failsFastOnErrors(),
+/// messageHandler() and trustsInput() are restored to their default values.
+- (void) reset;
+
 @end
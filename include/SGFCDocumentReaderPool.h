@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class SGFCCompiledArguments;
+@class SGFCDocumentReader;
+
+/// @brief The SGFCDocumentReaderPool class manages a pool of reusable
+/// SGFCDocumentReader objects that are all configured with the same
+/// arguments. Use SGFCKitFactory to construct new SGFCDocumentReaderPool
+/// objects.
+///
+/// @ingroup public-api
+/// @ingroup sgfc-frontend
+///
+/// SGFCDocumentReaderPool is useful for clients that perform a large number
+/// of read operations with the same arguments, e.g. a service that handles
+/// one document per request. Instead of creating a new SGFCDocumentReader
+/// object for every request, the client acquires an SGFCDocumentReader
+/// object from the pool, uses it for one or more read operations, and then
+/// relinquishes it back to the pool.
+///
+/// Every SGFCDocumentReader object that the pool hands out is configured
+/// with the arguments of the SGFCCompiledArguments object that was used to
+/// construct the pool. When an SGFCDocumentReader object is relinquished,
+/// the pool invokes SGFCDocumentReader::reset() so that changes made by the
+/// previous client do not affect the next client.
+///
+/// The pool is initially empty. If the pool is empty when an
+/// SGFCDocumentReader object is acquired, the pool creates a new
+/// SGFCDocumentReader object. If the pool already contains
+/// maximumPoolSize() idle SGFCDocumentReader objects when an
+/// SGFCDocumentReader object is relinquished, the relinquished object is
+/// discarded. numberOfAcquisitions(), numberOfHits() and hitRate() can be
+/// used to find out whether maximumPoolSize() is adequate.
+///
+/// SGFCDocumentReaderPool can be used from multiple threads at the same
+/// time. An SGFCDocumentReader object that has been acquired, however,
+/// must be used by only one thread at a time.
+@interface SGFCDocumentReaderPool : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCDocumentReaderPool object that
+/// hands out SGFCDocumentReader objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentReader objects.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (instancetype) poolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize;
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Initializes an SGFCDocumentReaderPool object that hands out
+/// SGFCDocumentReader objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentReader objects.
+///
+/// This is the designated initializer of SGFCDocumentReaderPool.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the arguments that the SGFCDocumentReader objects handed
+/// out by the pool are configured with.
+@property(nonatomic, strong, readonly) SGFCCompiledArguments* compiledArguments;
+
+/// @brief Returns the maximum number of idle SGFCDocumentReader objects that
+/// the pool keeps.
+@property(nonatomic, readonly) NSUInteger maximumPoolSize;
+
+/// @brief Returns the number of idle SGFCDocumentReader objects that are
+/// currently in the pool.
+@property(nonatomic, readonly) NSUInteger numberOfIdleReaders;
+
+/// @brief Returns the number of times that an SGFCDocumentReader object
+/// has been acquired from the pool.
+@property(nonatomic, readonly) NSUInteger numberOfAcquisitions;
+
+/// @brief Returns the number of times that acquiring an SGFCDocumentReader
+/// object returned an idle object from the pool instead of creating a new
+/// object.
+@property(nonatomic, readonly) NSUInteger numberOfHits;
+
+/// @brief Returns numberOfHits() divided by numberOfAcquisitions(). Returns
+/// 0.0 if no SGFCDocumentReader object has been acquired yet.
+@property(nonatomic, readonly) double hitRate;
+
+/// @brief Returns an SGFCDocumentReader object that is configured with the
+/// arguments that compiledArguments() returns. The caller must pass the
+/// object to relinquishReader:() when it no longer needs it.
+- (SGFCDocumentReader*) acquireReader;
+
+/// @brief Resets @a reader and puts it back into the pool. @a reader must not
+/// be used anymore after this method has been invoked.
+///
+/// @exception NSInvalidArgumentException Is raised if @a reader is @e nil,
+/// if @a reader was not acquired from this pool, or if @a reader has already
+/// been relinquished since it was last acquired.
+- (void) relinquishReader:(SGFCDocumentReader*)reader;
+
+/// @brief Acquires an SGFCDocumentReader object, invokes @a block with the
+/// object, and relinquishes the object after @a block has returned, even if
+/// @a block raises an exception.
+///
+/// @exception NSInvalidArgumentException Is raised if @a block is @e nil.
+- (void) withReader:(void (^)(SGFCDocumentReader* reader))block;
+
+@end
@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSData;
+@class NSString;
+@class SGFCDocument;
+@class SGFCGame;
+
+/// @brief The SGFCDocumentSnapshot class converts an SGFCDocument to and from
+/// a compact binary snapshot format. Loading a snapshot bypasses the SGFC
+/// backend entirely, so it is much faster than reading SGF content with
+/// SGFCDocumentReader. Use SGFCKitFactory to construct new
+/// SGFCDocumentSnapshot objects.
+///
+/// @ingroup public-api
+/// @ingroup document
+///
+/// A snapshot is meant to be used for SGF content that has already been
+/// read and checked by SGFCDocumentReader at least once. The snapshot
+/// records the structure of the document object tree, the property names
+/// and the typed property values. The property values are not checked or
+/// corrected in any way when the snapshot is loaded.
+///
+/// The raw values of typed property values are not recorded. When the
+/// snapshot is loaded, the raw value of a typed property value is built
+/// from the typed value, the same way as for a property value that is
+/// created programmatically. The raw value may therefore differ from the
+/// raw value in the original SGF content, e.g. a real value "6.50" becomes
+/// "6.5", and soft line breaks in text values are lost. Go pass moves keep
+/// their raw value, i.e. a "tt" pass move remains a "tt" pass move. Property
+/// values that have no typed value keep their raw value, but lose their
+/// value type: valueType() returns #SGFCPropertyValueTypeUnknown for them
+/// after the snapshot is loaded, as for values of custom properties.
+///
+/// The snapshot format consists of a fixed size header, followed by
+/// a number of tables with fixed size records:
+/// - A table with one record per game. The record contains the board size
+///   of the game and the range of the game's nodes in the node table.
+/// - A table with one record per node. The record contains the index of the
+///   node's first child node and next sibling node, and the range of the
+///   node's properties in the property table.
+/// - A table with one record per property. The record contains the index of
+///   the property name in the string table, and the range of the property's
+///   values in the property value table.
+/// - A table with one record per property value. The record contains the
+///   value type and the typed value. Strings are stored as an index into the
+///   string table. Composed property values refer to a separate table that
+///   contains the two single values that make up the composed value.
+/// - A string table. Every distinct string is stored only once.
+///
+/// All numbers are stored in little endian byte order. The snapshot format
+/// is versioned. A snapshot can only be loaded by the same library version
+/// that created it.
+///
+/// Because all records have a fixed size, SGFCDocumentSnapshot does not need
+/// to parse the snapshot data up front. A snapshot loaded with
+/// snapshotWithContentsOfFile:() is memory mapped, and the libsgfc++ and
+/// SgfcKit objects that make up a game are materialized only when the game
+/// is requested with gameAtIndex:() or document().
+@interface SGFCDocumentSnapshot : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to the snapshot data @a snapshotData. @a snapshotData is
+/// not copied.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotData is
+/// @e nil, or if @a snapshotData does not contain valid snapshot data.
++ (instancetype) snapshotWithData:(NSData*)snapshotData;
+
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to the snapshot data in the file located at the specified
+/// path. The file is memory mapped if possible. Returns @e nil if the file
+/// cannot be read.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotFilePath is
+/// @e nil, or if the file does not contain valid snapshot data.
++ (instancetype) snapshotWithContentsOfFile:(NSString*)snapshotFilePath;
+
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to snapshot data created from the content of
+/// @a document.
+///
+/// @exception NSInvalidArgumentException Is raised if @a document is @e nil.
+/// @exception SGFCDocumentStructureException Is raised if @a document
+/// contains one or more games that have no root node.
++ (instancetype) snapshotWithDocument:(SGFCDocument*)document;
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Initializes an SGFCDocumentSnapshot object that provides access to
+/// the snapshot data @a snapshotData. @a snapshotData is not copied.
+///
+/// This is the designated initializer of SGFCDocumentSnapshot.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotData is
+/// @e nil, or if @a snapshotData does not contain valid snapshot data.
+- (instancetype) initWithData:(NSData*)snapshotData NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the snapshot data.
+@property(nonatomic, strong, readonly) NSData* snapshotData;
+
+/// @brief Writes the snapshot data to the file located at the specified
+/// path. Returns YES if the write operation was successful. Returns NO
+/// if the write operation failed.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotFilePath is
+/// @e nil.
+- (BOOL) writeToFile:(NSString*)snapshotFilePath;
+
+/// @brief Returns the number of games in the snapshot.
+@property(nonatomic, readonly) NSUInteger numberOfGames;
+
+/// @brief Returns a newly constructed SGFCGame object with the content of the
+/// game at index position @a index. Every invocation materializes a new,
+/// independent game tree.
+///
+/// @exception NSInvalidArgumentException Is raised if @a index is equal to
+/// or greater than numberOfGames().
+- (SGFCGame*) gameAtIndex:(NSUInteger)index;
+
+/// @brief Returns a newly constructed SGFCDocument object with the content of
+/// all games in the snapshot. Every invocation materializes a new,
+/// independent document object tree.
+@property(nonatomic, strong, readonly) SGFCDocument* document;
+
+@end
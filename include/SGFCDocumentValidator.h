@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+@class SGFCDocument;
+@class SGFCGame;
+
+/// @brief The SGFCDocumentValidator class checks the object tree of an
+/// SGFCDocument or SGFCGame in memory and reports the problems it finds as
+/// SGFCMessage objects. Unlike SGFCDocumentWriter's validateDocument:(),
+/// SGFCDocumentValidator does not generate SGF content and does not invoke
+/// the SGFC backend. Use SGFCKitFactory to construct new
+/// SGFCDocumentValidator objects.
+///
+/// @ingroup public-api
+/// @ingroup document
+///
+/// SGFCDocumentValidator visits every node of every game tree exactly once,
+/// so the cost of a validation operation is proportional to the number of
+/// nodes and properties in the object tree. This makes SGFCDocumentValidator
+/// suitable for validating a document after every change that the library
+/// client makes to it.
+///
+/// The checks that SGFCDocumentValidator performs are a subset of the checks
+/// that SGFC performs:
+/// - Game level: The game types of all games are the same; the game type is
+///   a known game type and is Go; the board size is valid for the game type.
+/// - Property level: Property identifiers contain no lowercase characters;
+///   a property has at least one value unless its value type is "none" or
+///   "elist"; a property that can only have a single value does not have
+///   more than one value; all property values have the value type that the
+///   SGF standard defines for the property.
+/// - Node level: A property appears only once; root properties appear only
+///   in the root node; game info properties appear only once on a path from
+///   the root node to a leaf node; a node contains no move properties if it
+///   is the root node or if it also contains setup properties; a node does
+///   not contain a black and a white move; move annotation properties appear
+///   only in a node that also contains a move property.
+///
+/// Each problem is reported with the SGFCMessageID that SGFC uses for the
+/// same problem, and with the SGFCMessageType that SGFC uses for the FF4
+/// file format. As there is no SGF content, the messages have no line and
+/// column number. The message text names the 1-based number of the game in
+/// which the problem was found.
+///
+/// SGFCDocumentValidator does not check property values for correctness
+/// beyond their value type (e.g. it does not check whether a Go point lies
+/// on the board), and it does not perform any checks that SGFC performs on
+/// the raw SGF content. If a document passes validation by
+/// SGFCDocumentValidator, SGFCDocumentWriter may therefore still generate
+/// messages when it writes the document.
+///
+/// SGFCDocumentValidator has no state, so a single SGFCDocumentValidator
+/// object can be used for any number of validation operations. A library
+/// client that validates the same game repeatedly, e.g. after every change,
+/// should use SGFCGame::validateIncrementally() instead.
+@interface SGFCDocumentValidator : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCDocumentValidator object.
++ (instancetype) documentValidator;
+
+/// @brief Initializes an SGFCDocumentValidator object.
+///
+/// This is the designated initializer of SGFCDocumentValidator.
+- (instancetype) init NS_DESIGNATED_INITIALIZER;
+
+/// @brief Validates the content of @a document.
+///
+/// @return A collection of SGFCMessage objects, one for each problem that
+/// was found. The collection is empty if no problems were found. The
+/// messages appear in the order in which the games appear in @a document,
+/// and within a game in the order in which a depth-first traversal
+/// visits the nodes of the game tree.
+///
+/// @exception NSInvalidArgumentException Is raised if @a document is @e nil.
+/// @exception SGFCDocumentStructureException Is raised if @a document
+/// contains one or more games that have no root node.
+- (NSArray*) validateDocument:(SGFCDocument*)document;
+
+/// @brief Validates the content of @a game. The message texts refer to
+/// @a game as game number 1.
+///
+/// @return A collection of SGFCMessage objects, one for each problem that
+/// was found. The collection is empty if no problems were found.
+///
+/// @exception NSInvalidArgumentException Is raised if @a game is @e nil.
+/// @exception SGFCDocumentStructureException Is raised if @a game has no
+/// root node.
+- (NSArray*) validateGame:(SGFCGame*)game;
+
+@end
@@ -16,12 +16,16 @@
 
 #pragma once
 
+// Project includes
+#import "SGFCMessage.h"
+
 // System includes
 #import <Foundation/NSObject.h>
 
 // Forward declarations
 @class NSString;
 @class SGFCArguments;
+@class SGFCCompiledArguments;
 @class SGFCDocument;
 @class SGFCDocumentWriteResult;
 
@@ -93,11 +97,35 @@
 /// @brief Returns a newly constructed SGFCDocumentWriter object.
 + (instancetype) documentWriter;
 
+/// @brief Returns a newly constructed SGFCDocumentWriter object whose
+/// collection of arguments initially contains the arguments in
+/// @a compiledArguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (instancetype) documentWriterWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Initializes an SGFCDocumentWriter object.
 ///
 /// This is the designated initializer of SGFCArguments.
 - (instancetype) init NS_DESIGNATED_INITIALIZER;
 
+/// @brief Initializes an SGFCDocumentWriter object whose collection of
+/// arguments initially contains the arguments in @a compiledArguments.
+///
+/// Unlike adding the same arguments to the collection that arguments()
+/// returns, this does not create wrapper objects for the arguments and does
+/// not convert argument values. Changes to the collection that arguments()
+/// returns do not affect @a compiledArguments.
+///
+/// Unlike init() this does not add #SGFCArgumentTypeDefaultEncoding with the
+/// parameter "UTF-8" to the collection of arguments. Include that argument
+/// in @a compiledArguments if it is needed.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Returns an object with the collection of arguments that
 /// SGFCDocumentWriter passes on to SGFC whenever it performs a write
 /// operation.
@@ -113,6 +141,21 @@
 /// that repeated write operations use the same arguments.
 @property(nonatomic, strong, readonly) SGFCArguments* arguments;
 
+/// @brief A block that is invoked once for each message of a write or
+/// validation operation, before the operation returns its result. The
+/// default is @e nil.
+///
+/// If the block sets its @e stop parameter to YES, the block is not invoked
+/// for the remaining messages of the operation. The SGFCDocumentWriteResult
+/// object always contains all messages.
+///
+/// The SGFCMessage objects passed to the block are not the same objects
+/// as the ones in the SGFCDocumentWriteResult object's parse result.
+///
+/// @note The SGFC backend reports messages only after it has completed the
+/// operation, so the block is invoked after the SGF data has been written.
+@property(nonatomic, copy) SGFCMessageHandler messageHandler;
+
 /// @brief Writes the content of @a document to a single .sgf file located
 /// at the specified path, using the arguments that arguments() currently
 /// returns.
@@ -165,6 +208,9 @@
 ///
 /// @attention Read the class documentation for a note about encodings.
 ///
+/// @see SGFCDocumentValidator for a faster validation that checks the object
+/// tree in memory, but only performs a subset of the SGFC checks.
+///
 /// @return An SGFCDocumentWriteResult object that provides the result of
 /// the validation operation.
 ///
@@ -181,4 +227,16 @@
 /// SGFC for parsing and writing.
 - (void) debugPrintToConsole:(SGFCDocument*)document;
 
+/// @brief Restores the state that the SGFCDocumentWriter object had
+/// immediately after it was initialized, so that it can be reused by a
+/// different client.
+///
+/// The collection of arguments is restored to its initial content, i.e.
+/// either the default content or the arguments of the SGFCCompiledArguments
+/// object that was used for initialization. The SGFCArguments object that
+/// arguments() returned before this method was invoked no longer has any
+/// effect on write operations. messageHandler() is restored to its default
+/// value.
+- (void) reset;
+
 @end
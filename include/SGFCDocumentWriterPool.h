@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class SGFCCompiledArguments;
+@class SGFCDocumentWriter;
+
+/// @brief The SGFCDocumentWriterPool class manages a pool of reusable
+/// SGFCDocumentWriter objects that are all configured with the same
+/// arguments. Use SGFCKitFactory to construct new SGFCDocumentWriterPool
+/// objects.
+///
+/// @ingroup public-api
+/// @ingroup sgfc-frontend
+///
+/// SGFCDocumentWriterPool is useful for clients that perform a large number
+/// of write operations with the same arguments, e.g. a service that handles
+/// one document per request. Instead of creating a new SGFCDocumentWriter
+/// object for every request, the client acquires an SGFCDocumentWriter
+/// object from the pool, uses it for one or more write operations, and then
+/// relinquishes it back to the pool.
+///
+/// Every SGFCDocumentWriter object that the pool hands out is configured
+/// with the arguments of the SGFCCompiledArguments object that was used to
+/// construct the pool. When an SGFCDocumentWriter object is relinquished,
+/// the pool invokes SGFCDocumentWriter::reset() so that changes made by the
+/// previous client do not affect the next client.
+///
+/// The pool is initially empty. If the pool is empty when an
+/// SGFCDocumentWriter object is acquired, the pool creates a new
+/// SGFCDocumentWriter object. If the pool already contains
+/// maximumPoolSize() idle SGFCDocumentWriter objects when an
+/// SGFCDocumentWriter object is relinquished, the relinquished object is
+/// discarded. numberOfAcquisitions(), numberOfHits() and hitRate() can be
+/// used to find out whether maximumPoolSize() is adequate.
+///
+/// SGFCDocumentWriterPool can be used from multiple threads at the same
+/// time. An SGFCDocumentWriter object that has been acquired, however,
+/// must be used by only one thread at a time.
+@interface SGFCDocumentWriterPool : NSObject
+{
+}
+
+/// @brief Returns a newly constructed SGFCDocumentWriterPool object that
+/// hands out SGFCDocumentWriter objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentWriter objects.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (instancetype) poolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize;
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Initializes an SGFCDocumentWriterPool object that hands out
+/// SGFCDocumentWriter objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentWriter objects.
+///
+/// This is the designated initializer of SGFCDocumentWriterPool.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the arguments that the SGFCDocumentWriter objects handed
+/// out by the pool are configured with.
+@property(nonatomic, strong, readonly) SGFCCompiledArguments* compiledArguments;
+
+/// @brief Returns the maximum number of idle SGFCDocumentWriter objects that
+/// the pool keeps.
+@property(nonatomic, readonly) NSUInteger maximumPoolSize;
+
+/// @brief Returns the number of idle SGFCDocumentWriter objects that are
+/// currently in the pool.
+@property(nonatomic, readonly) NSUInteger numberOfIdleWriters;
+
+/// @brief Returns the number of times that an SGFCDocumentWriter object
+/// has been acquired from the pool.
+@property(nonatomic, readonly) NSUInteger numberOfAcquisitions;
+
+/// @brief Returns the number of times that acquiring an SGFCDocumentWriter
+/// object returned an idle object from the pool instead of creating a new
+/// object.
+@property(nonatomic, readonly) NSUInteger numberOfHits;
+
+/// @brief Returns numberOfHits() divided by numberOfAcquisitions(). Returns
+/// 0.0 if no SGFCDocumentWriter object has been acquired yet.
+@property(nonatomic, readonly) double hitRate;
+
+/// @brief Returns an SGFCDocumentWriter object that is configured with the
+/// arguments that compiledArguments() returns. The caller must pass the
+/// object to relinquishWriter:() when it no longer needs it.
+- (SGFCDocumentWriter*) acquireWriter;
+
+/// @brief Resets @a writer and puts it back into the pool. @a writer must not
+/// be used anymore after this method has been invoked.
+///
+/// @exception NSInvalidArgumentException Is raised if @a writer is @e nil,
+/// if @a writer was not acquired from this pool, or if @a writer has already
+/// been relinquished since it was last acquired.
+- (void) relinquishWriter:(SGFCDocumentWriter*)writer;
+
+/// @brief Acquires an SGFCDocumentWriter object, invokes @a block with the
+/// object, and relinquishes the object after @a block has returned, even if
+/// @a block raises an exception.
+///
+/// @exception NSInvalidArgumentException Is raised if @a block is @e nil.
+- (void) withWriter:(void (^)(SGFCDocumentWriter* writer))block;
+
+@end
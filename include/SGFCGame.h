@@ -25,6 +25,8 @@
 #import <Foundation/NSObject.h>
 
 // Forward declarations
+@class SGFCDocument;
+@class SGFCGameHistory;
 @class SGFCGameInfo;
 @class SGFCNode;
 @class SGFCTreeBuilder;
@@ -46,7 +48,14 @@
 /// affect all games. Notably these include the game type and the board size.
 /// This means that if a game tree contains multiple games, all of them must
 /// have the same game type and the same board size.
-@interface SGFCGame : NSObject
+///
+/// SGFCGame adopts the NSCopying protocol. Invoking @e copy returns a deep
+/// copy of the game and its entire game tree. The copy is not associated
+/// with any document and is never frozen. Only the copy's root node is wrapped
+/// immediately, all other nodes are wrapped when they are accessed. The
+/// original and the copy share their property values, which is possible
+/// because property values are immutable.
+@interface SGFCGame : NSObject <NSCopying>
 {
 }
 
@@ -257,4 +266,73 @@
 /// game tree.
 @property(nonatomic, strong, readonly) SGFCTreeBuilder* treeBuilder;
 
+/// @brief Starts recording the changes that are made to the game tree so
+/// that they can be undone and redone. Does nothing if the history is
+/// already enabled.
+///
+/// @see SGFCGameHistory
+- (void) enableHistory;
+
+/// @brief Returns the SGFCGameHistory object that records the changes made to
+/// the game tree. Returns @e nil if enableHistory() has not been invoked.
+@property(nonatomic, strong, readonly) SGFCGameHistory* history;
+
+/// @brief Validates the game tree in memory, like
+/// SGFCDocumentValidator::validateGame:() does, but re-checks only the parts
+/// of the game tree that have changed since the previous invocation.
+///
+/// The game keeps track of the nodes that are changed with the game's
+/// SGFCTreeBuilder object, with SGFCNode objects that are obtained from the
+/// game, and with SGFCProperty objects that are obtained from such SGFCNode
+/// objects. The first invocation checks every node. Subsequent invocations
+/// re-check only the changed nodes and the nodes whose game info context
+/// has changed, and take the result for all other nodes from the result of
+/// the previous invocation. Subtrees that are unchanged and contained no
+/// problems are skipped entirely. The cost of an invocation is therefore
+/// roughly proportional to the size of the changes since the previous
+/// invocation, not to the size of the game tree. After an undo() or redo()
+/// of the game's history the next invocation checks every node again.
+///
+/// Changes made with SGFCNode or SGFCProperty objects that were obtained from
+/// a different game are not tracked. Do not invoke this method concurrently
+/// from multiple threads, not even if the game is frozen.
+///
+/// The message texts refer to the game as game number 1. Use
+/// validateIncrementallyInDocument:() if the game is part of a document.
+///
+/// @return A collection of SGFCMessage objects, one for each problem that
+/// was found. The collection is empty if no problems were found.
+///
+/// @exception SGFCDocumentStructureException Is raised if the game has no
+/// root node.
+- (NSArray*) validateIncrementally;
+
+/// @brief Validates the game tree in memory, like validateIncrementally()
+/// does. The message texts refer to the game by its position in
+/// @a document, like SGFCDocumentValidator::validateDocument:() does.
+///
+/// Checks that concern several games of @a document, e.g. whether all games
+/// have the same game type, are not performed.
+///
+/// @return A collection of SGFCMessage objects, one for each problem that
+/// was found. The collection is empty if no problems were found.
+///
+/// @exception NSInvalidArgumentException Is raised if @a document is @e nil,
+/// or if @a document does not contain the game.
+/// @exception SGFCDocumentStructureException Is raised if the game has no
+/// root node.
+- (NSArray*) validateIncrementallyInDocument:(SGFCDocument*)document;
+
+/// @brief Returns YES if the game is frozen. Returns NO if the game is not
+/// frozen.
+///
+/// A game is frozen if it is part of a frozen SGFCDocument. The root node
+/// and all other SGFCNode objects that a frozen game returns are frozen as
+/// well. Setting the root node, invoking writeGameInfo:() or manipulating
+/// the game tree via treeBuilder() raises an SGFCInvalidOperationException
+/// while the game is frozen.
+///
+/// @see SGFCDocument::freeze()
+@property(nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
 @end
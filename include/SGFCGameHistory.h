@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class SGFCGame;
+
+/// @brief The SGFCGameHistory class records the changes that are made to the
+/// game tree of an SGFCGame object, and allows to undo and redo these
+/// changes.
+///
+/// @ingroup public-api
+/// @ingroup game-tree
+///
+/// Do @b NOT attempt to create an SGFCGameHistory object yourself, instead
+/// invoke SGFCGame::enableHistory(). From then on the following changes are
+/// recorded:
+/// - Changes made with the SGFCTreeBuilder object of the game.
+/// - Setting SGFCGame::rootNode() and invoking SGFCGame::writeGameInfo:().
+/// - Property changes made with SGFCNode objects that are obtained from the
+///   game after the history was enabled, i.e. the root node and all nodes
+///   that are reached by navigating from there.
+/// - Property value changes made with SGFCProperty objects that are obtained
+///   from such SGFCNode objects.
+///
+/// Changes made with SGFCNode or SGFCProperty objects that were obtained
+/// before the history was enabled are not recorded.
+///
+/// Recorded changes are grouped into versions. commitVersion() closes the
+/// current version, undo() reverts the most recent version and redo()
+/// re-applies the most recently reverted version. Making a change after
+/// undo() discards the versions that could have been re-applied with redo().
+///
+/// The history does not copy the game tree. A recorded change references
+/// only the nodes and properties whose links or contents the change
+/// modified. Unchanged parts of the game tree are shared by all versions.
+/// Committing a version is therefore a constant time operation, the cost of
+/// undo() and redo() is proportional to the number of changes in the
+/// version, and the memory used by the history grows with the number of
+/// changes, not with the number of versions.
+@interface SGFCGameHistory : NSObject
+{
+}
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Returns the SGFCGame object whose changes the SGFCGameHistory
+/// records.
+@property(nonatomic, weak, readonly) SGFCGame* game;
+
+/// @brief Returns YES if undo() can be invoked. Returns NO if there are
+/// no recorded changes that can be reverted.
+@property(nonatomic, readonly) BOOL canUndo;
+
+/// @brief Returns YES if redo() can be invoked. Returns NO if there are
+/// no reverted versions that can be re-applied.
+@property(nonatomic, readonly) BOOL canRedo;
+
+/// @brief Returns YES if changes were recorded since the last time
+/// commitVersion() was invoked. Returns NO if no changes were recorded.
+@property(nonatomic, readonly) BOOL hasUncommittedChanges;
+
+/// @brief Closes the current version. Subsequent changes are recorded in a
+/// new version. Does nothing if hasUncommittedChanges() returns NO.
+- (void) commitVersion;
+
+/// @brief Reverts the changes in the most recent version. If
+/// hasUncommittedChanges() returns YES, the uncommitted changes are committed
+/// first and then reverted.
+///
+/// @exception SGFCInvalidOperationException Is raised if canUndo() returns
+/// NO, or if the game is frozen.
+- (void) undo;
+
+/// @brief Re-applies the changes in the most recently reverted version.
+///
+/// @exception SGFCInvalidOperationException Is raised if canRedo() returns
+/// NO, or if the game is frozen.
+- (void) redo;
+
+/// @brief Discards all recorded changes. Afterwards canUndo() and canRedo()
+/// return NO.
+- (void) removeAllVersions;
+
+@end
@@ -52,7 +52,8 @@
 @property(nonatomic, readonly, getter=isPassMove) BOOL passMove;
 
 /// @brief Returns the stone that was placed on the Go board by the move.
-/// Returns @e nil if isPassMove() returns YES.
+/// Returns @e nil if isPassMove() returns YES. The SGFCGoStone object is
+/// created when this property is accessed for the first time.
 @property(nonatomic, strong, readonly) SGFCGoStone* stone;
 
 /// @brief Returns the color of the player who made the move.
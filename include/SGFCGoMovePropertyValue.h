@@ -19,7 +19,9 @@
 // Project includes
 #import "SGFCBoardSize.h"
 #import "SGFCColor.h"
+#import "SGFCCoordinateSystem.h"
 #import "SGFCMovePropertyValue.h"
+#import "SGFCTypedefs.h"
 
 // Forward declarations
 @class NSString;
@@ -103,7 +105,45 @@
 - (instancetype) initWithColor:(SGFCColor)color NS_DESIGNATED_INITIALIZER;
 
 /// @brief Returns an SGFCGoMove object that contains the property value
-/// data.
+/// data. The SGFCGoMove object is created when this property is accessed
+/// for the first time.
+///
+/// Use the scalar accessors isPassMove(), playerColor(),
+/// xPositionInCoordinateSystem:() and yPositionInCoordinateSystem:() if you
+/// don't need the SGFCGoMove object itself.
 @property(nonatomic, strong, readonly) SGFCGoMove* goMove;
 
+/// @brief Returns YES if the move is a pass move. Returns NO if the
+/// move is not a pass move.
+///
+/// This is a convenience method that returns the same value as the
+/// SGFCGoMove::isPassMove() property of the SGFCGoMove object returned by
+/// goMove(), but without creating the SGFCGoMove object.
+@property(nonatomic, readonly, getter=isPassMove) BOOL passMove;
+
+/// @brief Returns the color of the player who made the move.
+///
+/// This is a convenience method that returns the same value as the
+/// SGFCGoMove::playerColor() property of the SGFCGoMove object returned by
+/// goMove(), but without creating the SGFCGoMove object.
+@property(nonatomic, readonly) SGFCColor playerColor;
+
+/// @brief Returns the 1-based x-axis position, in the specified coordinate
+/// system, of the stone that was placed by the move on the Go board.
+/// Returns 0 if isPassMove() returns YES.
+///
+/// This is a convenience method that does not create the SGFCGoMove,
+/// SGFCGoStone and SGFCGoPoint objects that are otherwise needed to obtain
+/// the position.
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
+/// @brief Returns the 1-based y-axis position, in the specified coordinate
+/// system, of the stone that was placed by the move on the Go board.
+/// Returns 0 if isPassMove() returns YES.
+///
+/// This is a convenience method that does not create the SGFCGoMove,
+/// SGFCGoStone and SGFCGoPoint objects that are otherwise needed to obtain
+/// the position.
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
 @end
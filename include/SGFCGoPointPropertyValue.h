@@ -18,7 +18,9 @@
 
 // Project includes
 #import "SGFCBoardSize.h"
+#import "SGFCCoordinateSystem.h"
 #import "SGFCPointPropertyValue.h"
+#import "SGFCTypedefs.h"
 
 // Forward declarations
 @class SGFCGoPoint;
@@ -85,7 +87,31 @@
                             boardSize:(SGFCBoardSize)boardSize NS_DESIGNATED_INITIALIZER;
 
 /// @brief Returns an SGFCGoPoint object that contains the property value
-/// data and makes it available in various forms and notations.
+/// data and makes it available in various forms and notations. The
+/// SGFCGoPoint object is created when this property is accessed for the
+/// first time.
+///
+/// Use the scalar accessors xPositionInCoordinateSystem:() and
+/// yPositionInCoordinateSystem:() if you don't need the SGFCGoPoint object
+/// itself.
 @property(nonatomic, strong, readonly) SGFCGoPoint* goPoint;
 
+/// @brief Returns the 1-based x-axis position of the point in the specified
+/// coordinate system. Returns 0 if goPoint() returns @e nil.
+///
+/// This is a convenience method that returns the same value as the
+/// SGFCGoPoint::xPositionInCoordinateSystem:() method of the SGFCGoPoint
+/// object returned by goPoint(), but without creating the SGFCGoPoint
+/// object.
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
+/// @brief Returns the 1-based y-axis position of the point in the specified
+/// coordinate system. Returns 0 if goPoint() returns @e nil.
+///
+/// This is a convenience method that returns the same value as the
+/// SGFCGoPoint::yPositionInCoordinateSystem:() method of the SGFCGoPoint
+/// object returned by goPoint(), but without creating the SGFCGoPoint
+/// object.
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
 @end
@@ -47,7 +47,8 @@
 /// @brief Returns the color of the stone.
 @property(nonatomic, readonly) SGFCColor color;
 
-/// @brief Returns the location of the stone on the Go board.
+/// @brief Returns the location of the stone on the Go board. The SGFCGoPoint
+/// object is created when this property is accessed for the first time.
 @property(nonatomic, strong, readonly) SGFCGoPoint* location;
 
 @end
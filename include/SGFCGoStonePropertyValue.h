@@ -19,7 +19,9 @@
 // Project includes
 #import "SGFCBoardSize.h"
 #import "SGFCColor.h"
+#import "SGFCCoordinateSystem.h"
 #import "SGFCStonePropertyValue.h"
+#import "SGFCTypedefs.h"
 
 // Forward declarations
 @class NSString;
@@ -91,7 +93,33 @@
                                 color:(SGFCColor)color NS_DESIGNATED_INITIALIZER;
 
 /// @brief Returns an SGFCGoStone object that contains the property value
-/// data.
+/// data. The SGFCGoStone object is created when this property is accessed
+/// for the first time.
+///
+/// Use the scalar accessors color(), xPositionInCoordinateSystem:() and
+/// yPositionInCoordinateSystem:() if you don't need the SGFCGoStone object
+/// itself.
 @property(nonatomic, strong, readonly) SGFCGoStone* goStone;
 
+/// @brief Returns the color of the stone.
+///
+/// This is a convenience method that returns the same value as the
+/// SGFCGoStone::color() property of the SGFCGoStone object returned by
+/// goStone(), but without creating the SGFCGoStone object.
+@property(nonatomic, readonly) SGFCColor color;
+
+/// @brief Returns the 1-based x-axis position, in the specified coordinate
+/// system, of the location of the stone.
+///
+/// This is a convenience method that does not create the SGFCGoStone and
+/// SGFCGoPoint objects that are otherwise needed to obtain the position.
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
+/// @brief Returns the 1-based y-axis position, in the specified coordinate
+/// system, of the location of the stone.
+///
+/// This is a convenience method that does not create the SGFCGoStone and
+/// SGFCGoPoint objects that are otherwise needed to obtain the position.
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem;
+
 @end
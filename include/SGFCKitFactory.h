@@ -20,11 +20,18 @@
 #import <Foundation/NSObject.h>
 
 // Forward declarations
+@class NSData;
+@class NSString;
 @class SGFCArguments;
 @class SGFCCommandLine;
+@class SGFCCompiledArguments;
 @class SGFCDocument;
 @class SGFCDocumentReader;
+@class SGFCDocumentReaderPool;
+@class SGFCDocumentSnapshot;
+@class SGFCDocumentValidator;
 @class SGFCDocumentWriter;
+@class SGFCDocumentWriterPool;
 @class SGFCGame;
 @class SGFCGameInfo;
 @class SGFCGoGameInfo;
@@ -45,6 +52,12 @@
 /// populate it with arguments.
 + (SGFCArguments*) emptyArguments;
 
+/// @brief Returns a newly constructed SGFCCompiledArguments object that
+/// contains a copy of the arguments in @a arguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
++ (SGFCCompiledArguments*) compiledArgumentsWithArguments:(SGFCArguments*)arguments;
+
 /// @brief Returns a newly constructed SGFCCommandLine object that passes
 /// the specified command line arguments to SGFC.
 ///
@@ -59,6 +72,13 @@
 /// @exception NSInvalidArgumentException Is raised if @a arguments is @e nil.
 + (SGFCCommandLine*) commandLineWithArguments:(SGFCArguments*)arguments;
 
+/// @brief Returns a newly constructed SGFCCommandLine object that passes
+/// the command line arguments in @a compiledArguments to SGFC.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (SGFCCommandLine*) commandLineWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
 /// @brief Returns a newly constructed SGFCCommandLine object that passes
 /// no command line arguments to SGFC.
 + (SGFCCommandLine*) commandLineWithNoArguments;
@@ -66,9 +86,45 @@
 /// @brief Returns a newly constructed SGFCDocumentReader object.
 + (SGFCDocumentReader*) documentReader;
 
+/// @brief Returns a newly constructed SGFCDocumentReader object whose
+/// collection of arguments initially contains the arguments in
+/// @a compiledArguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (SGFCDocumentReader*) documentReaderWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
+/// @brief Returns a newly constructed SGFCDocumentReaderPool object that
+/// hands out SGFCDocumentReader objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentReader objects.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (SGFCDocumentReaderPool*) documentReaderPoolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                                               maximumPoolSize:(NSUInteger)maximumPoolSize;
+
 /// @brief Returns a newly constructed SGFCDocumentWriter object.
 + (SGFCDocumentWriter*) documentWriter;
 
+/// @brief Returns a newly constructed SGFCDocumentWriter object whose
+/// collection of arguments initially contains the arguments in
+/// @a compiledArguments.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (SGFCDocumentWriter*) documentWriterWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments;
+
+/// @brief Returns a newly constructed SGFCDocumentWriterPool object that
+/// hands out SGFCDocumentWriter objects configured with the arguments in
+/// @a compiledArguments, and that keeps at most @a maximumPoolSize idle
+/// SGFCDocumentWriter objects.
+///
+/// @exception NSInvalidArgumentException Is raised if @a compiledArguments
+/// is @e nil, or if SGFCCompiledArguments::isValid() returns NO.
++ (SGFCDocumentWriterPool*) documentWriterPoolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                                               maximumPoolSize:(NSUInteger)maximumPoolSize;
+
 /// @brief Returns a newly constructed SGFCDocument object. The
 /// SGFCDocument content consists of a single SGFCGame object with an
 /// empty root node.
@@ -82,6 +138,34 @@
 /// no games.
 + (SGFCDocument*) documentWithGame:(SGFCGame*)game;
 
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to the snapshot data @a snapshotData.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotData is
+/// @e nil, or if @a snapshotData does not contain valid snapshot data.
++ (SGFCDocumentSnapshot*) documentSnapshotWithData:(NSData*)snapshotData;
+
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to the snapshot data in the file located at the specified
+/// path. The file is memory mapped if possible. Returns @e nil if the file
+/// cannot be read.
+///
+/// @exception NSInvalidArgumentException Is raised if @a snapshotFilePath is
+/// @e nil, or if the file does not contain valid snapshot data.
++ (SGFCDocumentSnapshot*) documentSnapshotWithContentsOfFile:(NSString*)snapshotFilePath;
+
+/// @brief Returns a newly constructed SGFCDocumentSnapshot object that
+/// provides access to snapshot data created from the content of
+/// @a document.
+///
+/// @exception NSInvalidArgumentException Is raised if @a document is @e nil.
+/// @exception SGFCDocumentStructureException Is raised if @a document
+/// contains one or more games that have no root node.
++ (SGFCDocumentSnapshot*) documentSnapshotWithDocument:(SGFCDocument*)document;
+
+/// @brief Returns a newly constructed SGFCDocumentValidator object.
++ (SGFCDocumentValidator*) documentValidator;
+
 /// @brief Returns a newly constructed SGFCGame object. The game type is
 /// #SGFCDefaultGameType. The game is not associated with any
 /// document. The game has a game tree that consists of an empty root node.
@@ -0,0 +1,182 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSDate.h>
+#import <Foundation/NSObject.h>
+
+/// @brief The SGFCKitMetricsSnapshot struct holds the values of all
+/// counters that SGFCKitMetrics maintains, taken at a single point in time.
+///
+/// @ingroup public-api
+/// @ingroup library-support
+///
+/// All values are accumulated from the time SGFCKitMetrics was last reset,
+/// but only for operations that took place while SGFCKitMetrics was
+/// enabled.
+typedef struct
+{
+  /// @name SGFCDocumentReader and SGFCDocumentWriter operations
+  //@{
+  /// @brief The number of read operations performed by SGFCDocumentReader.
+  unsigned long long ReadCount;
+
+  /// @brief The number of write and validation operations performed by
+  /// SGFCDocumentWriter.
+  unsigned long long WriteCount;
+
+  /// @brief The time spent in read operations performed by
+  /// SGFCDocumentReader. This includes SGFC parsing the SGF data, SGFC
+  /// checking the SGF data, and libsgfc++ building the document tree.
+  /// libsgfc++ performs these steps in a single call, so they cannot be
+  /// measured individually.
+  NSTimeInterval ReadDuration;
+
+  /// @brief The time spent in write and validation operations performed by
+  /// SGFCDocumentWriter.
+  NSTimeInterval WriteDuration;
+
+  /// @brief The number of bytes of SGF data that SGFCDocumentReader read.
+  unsigned long long BytesRead;
+
+  /// @brief The number of bytes of SGF data that SGFCDocumentWriter wrote.
+  unsigned long long BytesWritten;
+
+  /// @brief The number of nodes in the documents that SGFCDocumentReader
+  /// read and that SGFCDocumentWriter wrote or validated.
+  unsigned long long NodeCount;
+
+  /// @brief The number of properties in the documents that
+  /// SGFCDocumentReader read and that SGFCDocumentWriter wrote or validated.
+  unsigned long long PropertyCount;
+
+  /// @brief The number of property values in the documents that
+  /// SGFCDocumentReader read and that SGFCDocumentWriter wrote or validated.
+  unsigned long long PropertyValueCount;
+  //@}
+
+  /// @name Wrapping of libsgfc++ objects
+  //@{
+  /// @brief The time spent wrapping collections of libsgfc++ objects (games,
+  /// nodes, properties, property values, messages) into SgfcKit objects.
+  /// If a wrapping operation invokes other wrapping operations, the time is
+  /// counted only once.
+  NSTimeInterval WrapDuration;
+
+  /// @brief The number of SGFCDocument wrapper objects created.
+  unsigned long long DocumentWrapperCount;
+
+  /// @brief The number of SGFCGame wrapper objects created.
+  unsigned long long GameWrapperCount;
+
+  /// @brief The number of SGFCNode wrapper objects created.
+  unsigned long long NodeWrapperCount;
+
+  /// @brief The number of SGFCProperty wrapper objects created, including
+  /// objects of SGFCProperty subclasses.
+  unsigned long long PropertyWrapperCount;
+
+  /// @brief The number of wrapper objects created that implement
+  /// SGFCPropertyValue.
+  unsigned long long PropertyValueWrapperCount;
+
+  /// @brief The number of SGFCGoMove, SGFCGoPoint and SGFCGoStone wrapper
+  /// objects created.
+  unsigned long long GoObjectWrapperCount;
+
+  /// @brief The number of SGFCMessage wrapper objects created.
+  unsigned long long MessageWrapperCount;
+
+  /// @brief The number of other wrapper objects created (e.g. SGFCArgument,
+  /// SGFCGameInfo, SGFCDocumentReadResult).
+  unsigned long long OtherWrapperCount;
+
+  /// @brief The number of times an enumeration value or a string was mapped
+  /// between libsgfc++ and SgfcKit.
+  unsigned long long MappingCount;
+
+  /// @brief The number of times a string was copied between an NSString
+  /// and a libsgfc++ string. This is a subset of MappingCount.
+  unsigned long long StringCopyCount;
+
+  /// @brief The number of libsgfc++ objects (games, nodes, properties,
+  /// property values, game info objects) that SgfcKit's document model
+  /// created itself. Objects that libsgfc++ creates while it reads a
+  /// document are not counted. Creating an SgfcKit object from scratch
+  /// creates at least one libsgfc++ object, but wrapping an existing
+  /// libsgfc++ object ideally creates none.
+  unsigned long long LibSgfcObjectCount;
+  //@}
+
+  /// @name Background reclamation of documents
+  //@{
+  /// @brief The number of documents whose object graph was released on the
+  /// background thread. See SGFCDocument::reclaimsMemoryInBackground().
+  unsigned long long BackgroundReclamationCount;
+
+  /// @brief The time that the background thread spent releasing object
+  /// graphs of documents, i.e. the time that was moved off the threads that
+  /// released the documents.
+  NSTimeInterval BackgroundReclamationDuration;
+
+  /// @brief The reclamation lag, i.e. the time between the moment when the
+  /// documents were deallocated and the moment when the background thread
+  /// had finished releasing their object graphs. Divide by
+  /// BackgroundReclamationCount to get the average lag per document.
+  NSTimeInterval BackgroundReclamationLag;
+  //@}
+} SGFCKitMetricsSnapshot;
+
+/// @brief The SGFCKitMetrics class is a class that contains only class
+/// methods. The class methods provide access to an opt-in set of counters
+/// and timings that show where SgfcKit spends its time.
+///
+/// @ingroup public-api
+/// @ingroup library-support
+///
+/// SGFCKitMetrics is disabled by default. While it is disabled, the cost of
+/// the instrumentation points is a single relaxed atomic load each. Enable
+/// SGFCKitMetrics with setEnabled:(), perform the operations of interest,
+/// then obtain the counter values with snapshot().
+///
+/// The counters are global to the process, not per thread. All methods can
+/// be invoked from any thread.
+@interface SGFCKitMetrics : NSObject
+{
+}
+
+/// @brief Returns YES if SGFCKitMetrics currently records metrics. Returns
+/// NO if SGFCKitMetrics currently does not record metrics. The default is
+/// NO.
++ (BOOL) isEnabled;
+
+/// @brief Sets whether SGFCKitMetrics records metrics. Disabling
+/// SGFCKitMetrics does not reset the counters.
++ (void) setEnabled:(BOOL)enabled;
+
+/// @brief Returns the current values of all counters.
+///
+/// The counters are read one after the other, so if operations are
+/// performed concurrently on other threads the values in the snapshot may
+/// not be exactly consistent with each other.
++ (SGFCKitMetricsSnapshot) snapshot;
+
+/// @brief Resets all counters to zero.
++ (void) reset;
+
+@end
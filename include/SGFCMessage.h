@@ -29,6 +29,11 @@
 /// messages are generated by SGFC, but there are a few error cases where
 /// SgfcKit also generates messages. SGFCMessage objects are immutable.
 ///
+/// SGFCDocumentValidator also generates messages. These messages use the
+/// message IDs of the corresponding SGFC messages, but they do not refer to
+/// a line or column in SGF data because SGFCDocumentValidator does not
+/// generate any SGF data.
+///
 /// @ingroup public-api
 /// @ingroup sgfc-message
 ///
@@ -130,3 +135,14 @@
 @property(nonatomic, strong, readonly) NSString* formattedMessageText;
 
 @end
+
+/// @brief The SGFCMessageHandler block type is used by SGFCDocumentReader,
+/// SGFCDocumentWriter and SGFCCommandLine to pass the messages of an
+/// operation to a library client one message at a time. The block is invoked
+/// once for each message, in the order in which the messages were generated
+/// by SGFC. The block sets @a stop to YES to prevent further invocations for
+/// the remaining messages of the operation.
+///
+/// @ingroup public-api
+/// @ingroup sgfc-message
+typedef void (^SGFCMessageHandler)(SGFCMessage* message, BOOL* stop);
@@ -58,7 +58,15 @@
 /// aDictionary[firstChild2] = "bar";        // Overwrites the previous entry
 /// int numberOfEntries = aDictionary.count  // 1
 /// @endverbatim
-@interface SGFCNode : NSObject
+///
+/// SGFCNode adopts the NSCopying protocol. Invoking @e copy returns a deep
+/// copy of the node and of the entire sub tree dangling from it. The copy has
+/// no parent and no siblings, and it is not associated with any game, so
+/// properties that the original node inherits from its ancestors are not
+/// inherited by the copy. The copy is never frozen. The original and the copy
+/// share their property values, which is possible because property values are
+/// immutable.
+@interface SGFCNode : NSObject <NSCopying>
 {
 }
 
@@ -341,6 +349,28 @@
 /// @brief Removes all properties from the node's collection of properties.
 - (void) removeAllProperties;
 
+/// @brief Invokes @a updates, a block that is expected to make any number of
+/// changes to the node's collection of properties, and updates the
+/// collection returned by properties() only once after @a updates has
+/// finished.
+///
+/// Use this method to efficiently make many changes to the node's collection
+/// of properties with setProperty:(), appendProperty:(), removeProperty:(),
+/// removeAllProperties() or the properties() setter. The changes are applied
+/// to the underlying data immediately, but outside of a batch each change
+/// also updates the collection returned by properties(). Inside a batch that
+/// update is deferred until the batch ends, or until properties() is
+/// invoked, whichever comes first. SGFCProperty objects that are already
+/// in the collection are reused when the collection is updated.
+///
+/// Batches may be nested. The collection is updated when the outermost batch
+/// ends. If @a updates raises an exception the changes that were made before
+/// the exception was raised remain in effect, and the batch ends normally
+/// before the exception is propagated.
+///
+/// @exception NSInvalidArgumentException Is raised if @a updates is @e nil.
+- (void) performBatchUpdates:(void (^)(void))updates;
+
 /// @brief Returns the property with the specified type @a propertyType if
 /// the node has such a property. Returns @e nil if the node has no
 /// such property.
@@ -351,6 +381,11 @@
 ///
 /// The SGF standard defines that only one of each property is allowed per
 /// node.
+///
+/// The lookup is always made in the wrapped libsgfc++ node, so the result
+/// reflects changes made through other SGFCNode objects. The returned object
+/// is the same object that appears in the collection returned by
+/// properties().
 - (SGFCProperty*) propertyWithType:(SGFCPropertyType)propertyType;
 
 /// @brief Returns the property with the specified name @a propertyName if
@@ -360,6 +395,11 @@
 /// The SGF standard defines that only one of each property is allowed per
 /// node.
 ///
+/// The lookup is always made in the wrapped libsgfc++ node, so the result
+/// reflects changes made through other SGFCNode objects. The returned object
+/// is the same object that appears in the collection returned by
+/// properties().
+///
 /// @exception NSInvalidArgumentException Is raised if @a propertyName is
 /// @e nil.
 - (SGFCProperty*) propertyWithName:(NSString*)propertyName;
@@ -399,5 +439,21 @@
 /// simply returns a property's most recent occurrence and leaves the
 /// interpretation of the property value to the library client.
 @property(nonatomic, strong, readonly) NSArray* inheritedProperties;
+//@}
+
+/// @name Frozen state
+//@{
+/// @brief Returns YES if the node is frozen. Returns NO if the node is not
+/// frozen.
+///
+/// A node is frozen if it was obtained from a frozen SGFCDocument or
+/// SGFCGame, or from another frozen node. The SGFCNode and SGFCProperty
+/// objects that a frozen node returns are frozen as well. Any attempt to
+/// modify a frozen node, e.g. by setting or removing properties or by
+/// invoking writeGameInfo:(), raises an SGFCInvalidOperationException.
+///
+/// @see SGFCDocument::freeze()
+@property(nonatomic, readonly, getter=isFrozen) BOOL frozen;
+//@}
 
 @end
@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "SGFCColor.h"
+#import "SGFCTypedefs.h"
+
+// System includes
+#import <Foundation/NSObjCRuntime.h>
+
+/// @brief The SGFCPackedGoMove struct is a simple type that describes a move
+/// in a Go game without the overhead of creating SGFCGoMove, SGFCGoStone and
+/// SGFCGoPoint objects. SGFCPackedGoMove is used to efficiently pass large
+/// numbers of moves to SGFCTreeBuilder.
+///
+/// @ingroup public-api
+/// @ingroup go
+///
+/// The position of a move is specified in #SGFCCoordinateSystemUpperLeftOrigin,
+/// i.e. in the same coordinate system that is used by the SGF notation. The
+/// position is ignored if the move is a pass move.
+///
+/// @see SGFCPackedGoMoveMake
+/// @see SGFCPackedGoMoveMakePass
+typedef struct
+{
+  /// @brief The color of the player who made the move.
+  SGFCColor Color;
+
+  /// @brief YES if the move is a pass move, NO if the move places a stone
+  /// on the board.
+  BOOL IsPassMove;
+
+  /// @brief The 1-based x-axis position of the stone placed by the move.
+  SGFCGoPointAxisPosition XPosition;
+
+  /// @brief The 1-based y-axis position of the stone placed by the move.
+  SGFCGoPointAxisPosition YPosition;
+} SGFCPackedGoMove;
+
+// Prevent C++ name mangling
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /// @brief Returns an SGFCPackedGoMove value that describes a move made by
+  /// the player @a color which places a stone at the position @a xPosition
+  /// and @a yPosition.
+  extern SGFCPackedGoMove SGFCPackedGoMoveMake(SGFCColor color, SGFCGoPointAxisPosition xPosition, SGFCGoPointAxisPosition yPosition);
+
+  /// @brief Returns an SGFCPackedGoMove value that describes a pass move made
+  /// by the player @a color.
+  extern SGFCPackedGoMove SGFCPackedGoMoveMakePass(SGFCColor color);
+#ifdef __cplusplus
+}
+#endif
@@ -350,12 +350,27 @@
 /// NO if the property has no values.
 @property(nonatomic, readonly) BOOL hasPropertyValues;
 
+/// @brief Returns YES if the property is frozen. Returns NO if the property is
+/// not frozen.
+///
+/// A property is frozen if it was obtained from a frozen SGFCNode. Any
+/// attempt to modify the property values of a frozen property raises an
+/// SGFCInvalidOperationException.
+///
+/// @see SGFCDocument::freeze()
+@property(nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
 /// @brief A collection with the values of the property. The
 /// collection is empty if the property has no values. The order in which
 /// values appear in the collection matches the order in which values were
 /// specified when the SGFCProperty was constructed. The collection does not
 /// contain @e nil. The collection does not contain duplicates.
 ///
+/// The getter returns an immutable snapshot of the collection. The
+/// snapshot does not change when values are appended or removed later, and
+/// it is reused by subsequent invocations of the getter until the next
+/// change.
+///
 /// The EBNF in the SGF standard says that at least one value must be
 /// present. This can be a value that has the value type "None", which is
 /// defined to be an empty string. The meaning for the file content is
@@ -390,6 +405,28 @@
 /// collection of values.
 - (void) appendPropertyValue:(id<SGFCPropertyValue>)propertyValue;
 
+/// @brief Adds the values in @a propertyValues, in the order in which they
+/// appear in the collection, as the last values to the property's collection
+/// of values. @a propertyValues may not be @e nil. Elements in
+/// @a propertyValues must be objects that adopt the SGFCPropertyValue
+/// protocol.
+///
+/// Use this method instead of invoking appendPropertyValue:() repeatedly
+/// when many values need to be added, e.g. when setting up a position with
+/// #SGFCPropertyTypeAB or #SGFCPropertyTypeAW. The values are added to the
+/// underlying data in a single operation.
+///
+/// This setter makes no attempt to check the validity of the property's
+/// collection of values after adding @a propertyValues.
+///
+/// @see setPropertyValues:()
+///
+/// @exception NSInvalidArgumentException Is raised if @a propertyValues is
+/// @e nil, if @a propertyValues contains @e nil values, if @a propertyValues
+/// contains duplicate elements, or if one of the elements of
+/// @a propertyValues is already in the property's collection of values.
+- (void) appendPropertyValues:(NSArray*)propertyValues;
+
 /// @brief Removes @a propertyValue from the property's collection of
 /// values.
 ///
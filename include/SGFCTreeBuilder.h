@@ -16,6 +16,9 @@
 
 #pragma once
 
+// Project includes
+#import "SGFCPackedGoMove.h"
+
 // System includes
 #import <Foundation/NSObject.h>
 
@@ -23,6 +26,15 @@
 @class SGFCGame;
 @class SGFCNode;
 
+/// @brief The SGFCPackedGoMoveGenerator block type is used by SGFCTreeBuilder
+/// to obtain a sequence of moves one move at a time. The block is invoked
+/// with the 0-based index of the move to generate. The block stores the move
+/// in @a goMove and returns YES, or returns NO if there are no more moves.
+///
+/// @ingroup public-api
+/// @ingroup game-tree
+typedef BOOL (^SGFCPackedGoMoveGenerator)(NSUInteger moveIndex, SGFCPackedGoMove* goMove);
+
 /// @brief The SGFCTreeBuilder interface provides methods to manipulate the
 /// nodes of a game tree.
 ///
@@ -32,6 +44,10 @@
 /// Do @b NOT attempt to create an SGFCTreeBuilder object yourself, instead
 /// always use the SGFCTreeBuilder object provided by an SGFCGame instance
 /// whose game tree you want to manipulate.
+///
+/// All methods that manipulate nodes raise an SGFCInvalidOperationException
+/// if the SGFCGame object that game() returns is frozen, or if one of the
+/// nodes passed to the method is frozen. See SGFCDocument::freeze().
 @interface SGFCTreeBuilder : NSObject
 {
 }
@@ -184,4 +200,49 @@ beforeReferenceChild:(SGFCNode*)referenceChild;
 - (void) setParent:(SGFCNode*)parent
             ofNode:(SGFCNode*)node;
 
+/// @brief Creates a linear sequence of nodes, one node for each of the
+/// @a numberOfGoMoves moves in the C array @a goMoves, and adds the sequence
+/// as the last child of @a node. Each new node contains either a
+/// #SGFCPropertyTypeB or a #SGFCPropertyTypeW property, depending on the
+/// color of the move. Returns the node that was created for the last move,
+/// or @a node if @a numberOfGoMoves is 0.
+///
+/// The entire sequence is built in a single pass without creating
+/// intermediate SGFCNode, SGFCProperty or SGFCPropertyValue objects. The
+/// only wrapper object that is created is the return value. Use the returned
+/// node's navigation methods to obtain wrapper objects for the other new
+/// nodes on demand. Use this method instead of appendChild:toNode:() when
+/// many moves need to be added to a game tree, e.g. when converting the
+/// output of a Go engine.
+///
+/// The board size of the game that the SGFCTreeBuilder operates on is used
+/// to validate the moves. The game tree is not modified if a move is invalid.
+///
+/// @exception NSInvalidArgumentException Is raised if @a node is @e nil, if
+/// @a goMoves is @e NULL and @a numberOfGoMoves is greater than 0, if the
+/// game that the SGFCTreeBuilder operates on is not a Go game or has an
+/// invalid board size, or if one of the moves in @a goMoves is not a pass
+/// move and its position is not on the board.
+- (SGFCNode*) appendGoMoves:(const SGFCPackedGoMove*)goMoves
+            numberOfGoMoves:(NSUInteger)numberOfGoMoves
+                     toNode:(SGFCNode*)node;
+
+/// @brief Creates a linear sequence of nodes, one node for each move
+/// obtained from @a generator, and adds the sequence as the last child of
+/// @a node. @a generator is invoked repeatedly until it returns NO. Returns
+/// the node that was created for the last move, or @a node if
+/// @a generator did not generate any moves.
+///
+/// This method behaves the same as
+/// appendGoMoves:numberOfGoMoves:toNode:(), except that the moves are
+/// obtained from a block instead of a C array.
+///
+/// @exception NSInvalidArgumentException Is raised if @a node is @e nil, if
+/// @a generator is @e nil, if the game that the SGFCTreeBuilder operates on
+/// is not a Go game or has an invalid board size, or if one of the moves
+/// generated by @a generator is not a pass move and its position is not
+/// on the board.
+- (SGFCNode*) appendGoMovesToNode:(SGFCNode*)node
+                    withGenerator:(SGFCPackedGoMoveGenerator)generator;
+
 @end
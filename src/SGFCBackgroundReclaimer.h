@@ -0,0 +1,66 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#import <memory>
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+
+namespace LibSgfcPlusPlus
+{
+  class ISgfcDocument;
+}
+
+/// @brief The SGFCBackgroundReclaimer class releases the object graphs of
+/// documents on a low-priority background thread.
+///
+/// @ingroup internals
+/// @ingroup library-support
+///
+/// All functions in SGFCBackgroundReclaimer are class methods, so there is
+/// no need to create an instance of SGFCBackgroundReclaimer.
+///
+/// SGFCBackgroundReclaimer uses a single background thread that processes
+/// the documents in the order in which they were handed over. The thread is
+/// started when the first document is handed over, and then keeps running
+/// for the lifetime of the process. Its stack size is the same as the
+/// typical stack size of a process' main thread, so that the recursive
+/// destruction of deep libsgfc++ game trees does not overflow the stack.
+@interface SGFCBackgroundReclaimer : NSObject
+{
+}
+
+/// @brief Hands over the libsgfc++ document @a wrappedDocument and the
+/// wrapper objects in @a wrapperObjects to the background thread, which
+/// releases them. Sets @a wrapperObjects to @e nil, so that the background
+/// thread holds the only reference that the caller had.
+///
+/// Objects that are still referenced elsewhere are not deallocated by the
+/// background thread, but when the last of those references is dropped.
+///
+/// If SGFCKitMetrics is enabled, the background thread records the time
+/// between the hand-over and the moment when the objects have been
+/// released.
++ (void) reclaimWrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument
+                 wrapperObjects:(NSArray* __strong*)wrapperObjects;
+
+@end
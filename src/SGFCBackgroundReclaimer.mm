@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "interface/internal/SGFCKitMetricsInternalAdditions.h"
+#import "SGFCBackgroundReclaimer.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSAutoreleasePool.h>
+#import <Foundation/NSThread.h>
+
+// C++ Standard Library includes
+#import <chrono>
+#import <condition_variable>
+#import <deque>
+#import <mutex>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  struct ReclamationItem
+  {
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument> wrappedDocument;
+    NSArray* wrapperObjects;
+    std::chrono::steady_clock::time_point handOverTime;
+  };
+
+  // 8 MB is the default stack size of the main thread on macOS and most
+  // Linux distributions. Secondary threads by default get a much smaller
+  // stack (e.g. 512 KB on macOS).
+  const NSUInteger ReclamationThreadStackSize = 8 * 1024 * 1024;
+
+  std::mutex ReclamationMutex;
+  std::condition_variable ReclamationCondition;
+  std::deque<ReclamationItem> ReclamationQueue;
+  bool IsReclamationThreadStarted = false;
+}
+
+@implementation SGFCBackgroundReclaimer
+
+#pragma mark - Public API
+
++ (void) reclaimWrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument
+                 wrapperObjects:(NSArray* __strong*)wrapperObjects
+{
+  {
+    std::lock_guard<std::mutex> lock(ReclamationMutex);
+
+    // Transfer the references while the lock is held, so that the caller
+    // does not still hold a reference when the background thread releases
+    // the objects
+    ReclamationQueue.push_back(ReclamationItem());
+    ReclamationItem& item = ReclamationQueue.back();
+    item.wrappedDocument = std::move(wrappedDocument);
+    item.wrapperObjects = *wrapperObjects;
+    *wrapperObjects = nil;
+    item.handOverTime = std::chrono::steady_clock::now();
+
+    if (! IsReclamationThreadStarted)
+    {
+      NSThread* reclamationThread = [[NSThread alloc] initWithTarget:self
+                                                            selector:@selector(reclamationThreadMain)
+                                                              object:nil];
+      reclamationThread.name = @"SgfcKit background reclamation";
+      reclamationThread.stackSize = ReclamationThreadStackSize;
+      reclamationThread.qualityOfService = NSQualityOfServiceBackground;
+      [reclamationThread start];
+
+      IsReclamationThreadStarted = true;
+    }
+  }
+
+  ReclamationCondition.notify_one();
+}
+
+#pragma mark - Private API
+
++ (void) reclamationThreadMain
+{
+  while (true)
+  {
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument> wrappedDocument;
+    NSArray* wrapperObjects;
+    std::chrono::steady_clock::time_point handOverTime;
+
+    {
+      std::unique_lock<std::mutex> lock(ReclamationMutex);
+      ReclamationCondition.wait(lock, [] { return ! ReclamationQueue.empty(); });
+
+      ReclamationItem& item = ReclamationQueue.front();
+      wrappedDocument = std::move(item.wrappedDocument);
+      wrapperObjects = item.wrapperObjects;
+      item.wrapperObjects = nil;
+      handOverTime = item.handOverTime;
+      ReclamationQueue.pop_front();
+    }
+
+    // The objects are released outside of the lock so that handing over
+    // further documents is never blocked by a release in progress
+    auto startTime = std::chrono::steady_clock::now();
+    @autoreleasepool
+    {
+      wrapperObjects = nil;
+      wrappedDocument = nullptr;
+    }
+    auto endTime = std::chrono::steady_clock::now();
+
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::BackgroundReclamationCount);
+    SGFCKitMetricsAdd(
+      SGFCKitMetricsCounter::BackgroundReclamationDuration,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+    SGFCKitMetricsAdd(
+      SGFCKitMetricsCounter::BackgroundReclamationLag,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - handOverTime).count());
+  }
+}
+
+@end
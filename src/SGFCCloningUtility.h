@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#import <memory>
+
+// System includes
+#import <Foundation/NSObject.h>
+
+namespace LibSgfcPlusPlus
+{
+  class ISgfcDocument;
+  class ISgfcGame;
+  class ISgfcNode;
+}
+
+/// @brief The SGFCCloningUtility class is a container for various utility
+/// functions related to creating deep copies of libsgfc++ objects.
+///
+/// @ingroup internals
+/// @ingroup library-support
+///
+/// All functions in SGFCCloningUtility are class methods, so there is no
+/// need to create an instance of SGFCCloningUtility.
+///
+/// The copies created by SGFCCloningUtility consist of new libsgfc++ node,
+/// property, game and document objects. Property value objects are
+/// immutable, so they are not copied but shared between the original and
+/// the copy.
+@interface SGFCCloningUtility : NSObject
+{
+}
+
+/// @brief Returns a deep copy of the libsgfc++ ISgfcDocument object
+/// @a documentToClone. Each game in @a documentToClone is copied with
+/// cloneGame:().
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>) cloneDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)documentToClone;
+
+/// @brief Returns a deep copy of the libsgfc++ ISgfcGame object
+/// @a gameToClone. The game tree is copied with cloneNode:(). The copy is
+/// not associated with any document.
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>) cloneGame:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>)gameToClone;
+
+/// @brief Returns a deep copy of the libsgfc++ ISgfcNode object
+/// @a nodeToClone and the entire sub tree dangling from it. The copy has no
+/// parent and no siblings.
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) cloneNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)nodeToClone;
+
+@end
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCCloningUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+#import <libsgfcplusplus/ISgfcPropertyFactory.h>
+#import <libsgfcplusplus/ISgfcTreeBuilder.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// C++ Standard Library includes
+#import <utility>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // Returns a new node that has a copy of each property of @a nodeToClone,
+  // but no parent, children or siblings. The property values are shared.
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> CloneNodeWithoutRelatives(
+    const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>& nodeToClone,
+    const std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyFactory>& propertyFactory)
+  {
+    auto clonedNode = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateNode();
+    if (! nodeToClone->HasProperties())
+      return clonedNode;
+
+    const auto& propertiesToClone = nodeToClone->GetProperties();
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>> clonedProperties;
+    clonedProperties.reserve(propertiesToClone.size());
+
+    // Creating the property by name makes sure that the copy has the same
+    // concrete type as the original (e.g. ISgfcGameTypeProperty for GM),
+    // also for properties that are not defined in the SGF standard
+    for (const auto& propertyToClone : propertiesToClone)
+    {
+      clonedProperties.push_back(propertyFactory->CreateProperty(
+        propertyToClone->GetPropertyName(),
+        propertyToClone->GetPropertyValues()));
+    }
+
+    clonedNode->SetProperties(clonedProperties);
+
+    return clonedNode;
+  }
+}
+
+@implementation SGFCCloningUtility
+
+#pragma mark - Public API
+
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>) cloneDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)documentToClone
+{
+  auto clonedDocument = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument();
+
+  for (const auto& gameToClone : documentToClone->GetGames())
+    clonedDocument->AppendGame([self cloneGame:gameToClone]);
+
+  return clonedDocument;
+}
+
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>) cloneGame:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>)gameToClone
+{
+  auto rootNodeToClone = gameToClone->GetRootNode();
+  if (rootNodeToClone == nullptr)
+    return LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame();
+  else
+    return LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame([self cloneNode:rootNodeToClone]);
+}
+
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) cloneNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)nodeToClone
+{
+  auto propertyFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory();
+
+  // The tree builder operates on the nodes that are passed to it, the game
+  // is needed only to obtain a tree builder. It must stay alive until the
+  // copy is complete.
+  auto treeBuilderGame = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame();
+  auto treeBuilder = treeBuilderGame->GetTreeBuilder();
+
+  auto clonedNode = CloneNodeWithoutRelatives(nodeToClone, propertyFactory);
+
+  // Iterate instead of recursing so that deep trees (e.g. long games without
+  // variations) cannot overflow the stack. Each stack entry is a node whose
+  // children still need to be copied, paired with its copy.
+  std::vector<std::pair<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>, std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>>> nodesToVisit;
+  nodesToVisit.emplace_back(nodeToClone, clonedNode);
+
+  while (! nodesToVisit.empty())
+  {
+    auto [parentToClone, clonedParent] = std::move(nodesToVisit.back());
+    nodesToVisit.pop_back();
+
+    // Linking each child to its previous sibling avoids the search for the
+    // last child that appending a child would require
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> previousClonedChild;
+    for (auto childToClone = parentToClone->GetFirstChild(); childToClone != nullptr; childToClone = childToClone->GetNextSibling())
+    {
+      auto clonedChild = CloneNodeWithoutRelatives(childToClone, propertyFactory);
+
+      if (previousClonedChild == nullptr)
+        treeBuilder->SetFirstChild(clonedParent, clonedChild);
+      else
+        treeBuilder->SetNextSibling(previousClonedChild, clonedChild);
+
+      previousClonedChild = clonedChild;
+      nodesToVisit.emplace_back(childToClone, clonedChild);
+    }
+  }
+
+  return clonedNode;
+}
+
+@end
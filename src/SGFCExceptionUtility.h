@@ -61,6 +61,12 @@
 /// reason. @a reason is assumed to have UTF-8 encoding.
 + (void) raiseInvalidOperationExceptionWithCStringReason:(const char*)reason;
 
+/// @brief Does nothing if @a frozen is NO. Raises an
+/// SGFCInvalidOperationException if @a frozen is YES. The exception reason is
+/// a standard message that is parameterized with @a objectName.
++ (void) raiseInvalidOperationExceptionIfFrozen:(BOOL)frozen
+                                     objectName:(NSString*)objectName;
+
 /// @brief Raises an NSInternalInconsistencyException using @a reason as the
 /// reason.
 + (void) raiseInternalInconsistencyExceptionWithReason:(NSString*)reason;
@@ -69,6 +69,16 @@
   [self raiseInvalidOperationExceptionWithReason:[NSString stringWithUTF8String:reason]];
 }
 
++ (void) raiseInvalidOperationExceptionIfFrozen:(BOOL)frozen
+                                     objectName:(NSString*)objectName
+{
+  if (! frozen)
+    return;
+
+  NSString* reason = [NSString stringWithFormat:@"The %@ is frozen and cannot be modified", objectName];
+  [self raiseInvalidOperationExceptionWithReason:reason];
+}
+
 + (void) raiseInternalInconsistencyExceptionWithReason:(NSString*)reason
 {
   NSException* exception = [NSException exceptionWithName:NSInternalInconsistencyException
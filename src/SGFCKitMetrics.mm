@@ -0,0 +1,153 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../include/SGFCKitMetrics.h"
+#import "interface/internal/SGFCKitMetricsInternalAdditions.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+
+// C++ Standard Library includes
+#import <vector>
+
+std::atomic<bool> SGFCKitMetricsEnabled(false);
+std::atomic<std::uint64_t> SGFCKitMetricsCounters[static_cast<std::size_t>(SGFCKitMetricsCounter::NumberOfCounters)] = {};
+
+#pragma mark - Helper functions
+
+namespace
+{
+  std::uint64_t GetCounter(SGFCKitMetricsCounter counter)
+  {
+    return SGFCKitMetricsCounters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+  }
+
+  NSTimeInterval GetDurationCounter(SGFCKitMetricsCounter counter)
+  {
+    return GetCounter(counter) / 1000000000.0;
+  }
+}
+
+@implementation SGFCKitMetrics
+
+#pragma mark - Public API
+
++ (BOOL) isEnabled
+{
+  return SGFCKitMetricsIsEnabled() ? YES : NO;
+}
+
++ (void) setEnabled:(BOOL)enabled
+{
+  SGFCKitMetricsEnabled.store(enabled == YES, std::memory_order_relaxed);
+}
+
++ (SGFCKitMetricsSnapshot) snapshot
+{
+  SGFCKitMetricsSnapshot snapshot;
+
+  snapshot.ReadCount = GetCounter(SGFCKitMetricsCounter::ReadCount);
+  snapshot.WriteCount = GetCounter(SGFCKitMetricsCounter::WriteCount);
+  snapshot.ReadDuration = GetDurationCounter(SGFCKitMetricsCounter::ReadDuration);
+  snapshot.WriteDuration = GetDurationCounter(SGFCKitMetricsCounter::WriteDuration);
+  snapshot.BytesRead = GetCounter(SGFCKitMetricsCounter::BytesRead);
+  snapshot.BytesWritten = GetCounter(SGFCKitMetricsCounter::BytesWritten);
+  snapshot.NodeCount = GetCounter(SGFCKitMetricsCounter::NodeCount);
+  snapshot.PropertyCount = GetCounter(SGFCKitMetricsCounter::PropertyCount);
+  snapshot.PropertyValueCount = GetCounter(SGFCKitMetricsCounter::PropertyValueCount);
+  snapshot.WrapDuration = GetDurationCounter(SGFCKitMetricsCounter::WrapDuration);
+  snapshot.DocumentWrapperCount = GetCounter(SGFCKitMetricsCounter::DocumentWrapperCount);
+  snapshot.GameWrapperCount = GetCounter(SGFCKitMetricsCounter::GameWrapperCount);
+  snapshot.NodeWrapperCount = GetCounter(SGFCKitMetricsCounter::NodeWrapperCount);
+  snapshot.PropertyWrapperCount = GetCounter(SGFCKitMetricsCounter::PropertyWrapperCount);
+  snapshot.PropertyValueWrapperCount = GetCounter(SGFCKitMetricsCounter::PropertyValueWrapperCount);
+  snapshot.GoObjectWrapperCount = GetCounter(SGFCKitMetricsCounter::GoObjectWrapperCount);
+  snapshot.MessageWrapperCount = GetCounter(SGFCKitMetricsCounter::MessageWrapperCount);
+  snapshot.OtherWrapperCount = GetCounter(SGFCKitMetricsCounter::OtherWrapperCount);
+  snapshot.MappingCount = GetCounter(SGFCKitMetricsCounter::MappingCount);
+  snapshot.StringCopyCount = GetCounter(SGFCKitMetricsCounter::StringCopyCount);
+  snapshot.LibSgfcObjectCount = GetCounter(SGFCKitMetricsCounter::LibSgfcObjectCount);
+  snapshot.BackgroundReclamationCount = GetCounter(SGFCKitMetricsCounter::BackgroundReclamationCount);
+  snapshot.BackgroundReclamationDuration = GetDurationCounter(SGFCKitMetricsCounter::BackgroundReclamationDuration);
+  snapshot.BackgroundReclamationLag = GetDurationCounter(SGFCKitMetricsCounter::BackgroundReclamationLag);
+
+  return snapshot;
+}
+
++ (void) reset
+{
+  for (auto& counter : SGFCKitMetricsCounters)
+    counter.store(0, std::memory_order_relaxed);
+}
+
+#pragma mark - Internal API - SGFCKitMetricsInternalAdditions overrides
+
++ (void) recordContentOfDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document
+{
+  if (! SGFCKitMetricsIsEnabled() || document == nullptr)
+    return;
+
+  std::uint64_t nodeCount = 0;
+  std::uint64_t propertyCount = 0;
+  std::uint64_t propertyValueCount = 0;
+
+  // Iterate instead of recursing so that deep trees cannot overflow the
+  // stack. Pushing only the first child of a node, and moving on to the next
+  // sibling when a node is popped, keeps the stack as small as the depth of
+  // the tree.
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> nodesToVisit;
+  for (const auto& game : document->GetGames())
+  {
+    auto rootNode = game->GetRootNode();
+    if (rootNode != nullptr)
+      nodesToVisit.push_back(rootNode);
+
+    while (! nodesToVisit.empty())
+    {
+      auto node = nodesToVisit.back();
+      nodesToVisit.pop_back();
+
+      nodeCount++;
+      for (const auto& property : node->GetProperties())
+      {
+        propertyCount++;
+        propertyValueCount += property->GetPropertyValues().size();
+      }
+
+      // The root node's siblings, if any, belong to no game
+      if (node != rootNode)
+      {
+        auto nextSibling = node->GetNextSibling();
+        if (nextSibling != nullptr)
+          nodesToVisit.push_back(nextSibling);
+      }
+
+      auto firstChild = node->GetFirstChild();
+      if (firstChild != nullptr)
+        nodesToVisit.push_back(firstChild);
+    }
+  }
+
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::NodeCount, nodeCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::PropertyCount, propertyCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::PropertyValueCount, propertyValueCount);
+}
+
+@end
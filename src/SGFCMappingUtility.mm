@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../include/NSValue+SGFCDate.h"
+#import "interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "SGFCExceptionUtility.h"
 #import "SGFCMappingUtility.h"
 #import "SGFCPrivateConstants.h"
@@ -397,6 +398,9 @@
 
 + (NSString*) toSgfcKitString:(const std::string&)stringValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   // TODO Currently we have no guarantee from libsgfc++ about the encoding in
   // use, so we just assume UTF-8. Maybe we will have to do something here in
   // the future once libsgfc++ provides us with more information.
@@ -405,6 +409,9 @@
 
 + (std::string) fromSgfcKitString:(NSString*)stringValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   // TODO Currently we have no guarantee from libsgfc++ about the encoding in
   // use, so we just assume UTF-8. Maybe we will have to do something here in
   // the future once libsgfc++ provides us with more information.
@@ -413,51 +420,81 @@
 
 + (NSString*) toSgfcKitSimpleText:(const LibSgfcPlusPlus::SgfcSimpleText&)simpleTextValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [NSString stringWithUTF8String:simpleTextValue.c_str()];
 }
 
 + (LibSgfcPlusPlus::SgfcSimpleText) fromSgfcKitSimpleText:(NSString*)simpleTextValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [simpleTextValue UTF8String];
 }
 
 + (NSString*) toSgfcKitText:(const LibSgfcPlusPlus::SgfcText&)textValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [NSString stringWithUTF8String:textValue.c_str()];
 }
 
 + (LibSgfcPlusPlus::SgfcText) fromSgfcKitText:(NSString*)textValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [textValue UTF8String];
 }
 
 + (NSString*) toSgfcKitMove:(const LibSgfcPlusPlus::SgfcMove&)moveValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [NSString stringWithUTF8String:moveValue.c_str()];
 }
 
 + (LibSgfcPlusPlus::SgfcMove) fromSgfcKitMove:(NSString*)moveValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [moveValue UTF8String];
 }
 
 + (NSString*) toSgfcKitPoint:(const LibSgfcPlusPlus::SgfcPoint&)pointValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [NSString stringWithUTF8String:pointValue.c_str()];
 }
 
 + (LibSgfcPlusPlus::SgfcPoint) fromSgfcKitPoint:(NSString*)pointValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [pointValue UTF8String];
 }
 
 + (NSString*) toSgfcKitStone:(const LibSgfcPlusPlus::SgfcStone&)stoneValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [NSString stringWithUTF8String:stoneValue.c_str()];
 }
 
 + (LibSgfcPlusPlus::SgfcStone) fromSgfcKitStone:(NSString*)stoneValue
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::StringCopyCount);
+
   return [stoneValue UTF8String];
 }
 
@@ -593,6 +630,8 @@
                      usingMap:(NSDictionary*)map
                  withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsInt);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -615,6 +654,8 @@
                 usingMap:(NSDictionary*)map
             withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsUnsignedInteger);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -637,6 +678,8 @@
                           usingMap:(NSDictionary*)map
                       withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsInt);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -658,6 +701,8 @@
                       usingMap:(NSDictionary*)map
                   withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsSignedInteger);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -680,6 +725,8 @@
                                 usingMap:(NSDictionary*)map
                             withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsUnsignedInt64);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -703,6 +750,8 @@
                                   usingMap:(NSDictionary*)map
                               withEnumName:(NSString*)enumName
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   NSNumber* fromValueAsNumber = @(fromValueAsUnsignedInt64);
   NSNumber* mappedValueAsNumber = map[fromValueAsNumber];
   if (mappedValueAsNumber)
@@ -731,6 +780,8 @@
 + (uint64_t) mapFlagValue:(uint64_t)fromValueAsUnsignedInt64
                  usingMap:(NSDictionary*)map
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MappingCount);
+
   __block uint64_t toValueAsUnsignedInt64 = 0;
   if (fromValueAsUnsignedInt64 == 0)
     return toValueAsUnsignedInt64;
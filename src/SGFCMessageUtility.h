@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../include/SGFCMessage.h"
+#import "../include/SGFCMessageType.h"
+
+// C++ Standard Library includes
+#import <memory>
+#import <vector>
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// Forward declarations
+@class NSArray;
+
+namespace LibSgfcPlusPlus
+{
+  class ISgfcMessage;
+}
+
+/// @brief The SGFCMessageUtility class is a container for various utility
+/// functions that inspect a collection of libsgfc++ ISgfcMessage objects
+/// without wrapping all of them.
+///
+/// @ingroup internals
+/// @ingroup sgfc-frontend
+///
+/// All functions in SGFCMessageUtility are class methods, so there is no
+/// need to create an instance of SGFCMessageUtility.
+///
+/// The functions that return SGFCMessage objects accept a collection
+/// @a wrappedMessages that may be @e nil. If it is not @e nil it must
+/// contain the SGFCMessage objects that wrap @a messages, in the same order.
+/// The functions then return objects from that collection instead of
+/// creating new wrapper objects, so that the caller's clients always see
+/// the same wrapper object for the same message.
+@interface SGFCMessageUtility : NSObject
+{
+}
+
+/// @brief Returns the number of libsgfc++ ISgfcMessage objects in
+/// @a messages whose message type is @a messageType.
++ (NSUInteger) numberOfMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                       withType:(SGFCMessageType)messageType;
+
+/// @brief Returns a collection of SGFCMessage objects that wrap the first
+/// @a limit libsgfc++ ISgfcMessage objects in @a messages whose message type
+/// is @a messageType. The messages appear in the order in which they appear
+/// in @a messages.
++ (NSArray*) messages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+             withType:(SGFCMessageType)messageType
+                limit:(NSUInteger)limit
+      wrappedMessages:(NSArray*)wrappedMessages;
+
+/// @brief Returns an SGFCMessage object that wraps the first libsgfc++
+/// ISgfcMessage object in @a messages that is a critical message. Returns
+/// @e nil if @a messages contains no critical message.
++ (SGFCMessage*) firstCriticalMessage:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                      wrappedMessages:(NSArray*)wrappedMessages;
+
+/// @brief Invokes @a messageHandler once for each of the first @a limit
+/// libsgfc++ ISgfcMessage objects in @a messages, with a newly created
+/// SGFCMessage object that wraps the message. Returns the index of the
+/// message for which @a messageHandler requested to stop, or @e NSNotFound
+/// if @a messageHandler did not request to stop.
++ (NSUInteger) passMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                      limit:(NSUInteger)limit
+           toMessageHandler:(SGFCMessageHandler)messageHandler;
+
+@end
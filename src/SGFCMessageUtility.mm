@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCMappingUtility.h"
+#import "SGFCMessageUtility.h"
+#import "SGFCWrappingUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcMessage.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+
+@implementation SGFCMessageUtility
+
+#pragma mark - Public API
+
++ (NSUInteger) numberOfMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                       withType:(SGFCMessageType)messageType
+{
+  // Map the type once instead of mapping the type of every message
+  LibSgfcPlusPlus::SgfcMessageType wrappedMessageType = [SGFCMappingUtility fromSgfcKitMessageType:messageType];
+
+  NSUInteger numberOfMessages = 0;
+  for (const auto& message : messages)
+  {
+    if (message->GetMessageType() == wrappedMessageType)
+      numberOfMessages++;
+  }
+
+  return numberOfMessages;
+}
+
++ (NSArray*) messages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+             withType:(SGFCMessageType)messageType
+                limit:(NSUInteger)limit
+      wrappedMessages:(NSArray*)wrappedMessages
+{
+  LibSgfcPlusPlus::SgfcMessageType wrappedMessageType = [SGFCMappingUtility fromSgfcKitMessageType:messageType];
+
+  NSMutableArray* messagesWithType = [NSMutableArray array];
+
+  NSUInteger numberOfMessages = messages.size();
+  for (NSUInteger indexOfMessage = 0; indexOfMessage < numberOfMessages && messagesWithType.count < limit; indexOfMessage++)
+  {
+    const auto& message = messages[indexOfMessage];
+    if (message->GetMessageType() == wrappedMessageType)
+      [messagesWithType addObject:[self messageAtIndex:indexOfMessage inMessages:messages wrappedMessages:wrappedMessages]];
+  }
+
+  return messagesWithType;
+}
+
++ (SGFCMessage*) firstCriticalMessage:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                      wrappedMessages:(NSArray*)wrappedMessages
+{
+  NSUInteger numberOfMessages = messages.size();
+  for (NSUInteger indexOfMessage = 0; indexOfMessage < numberOfMessages; indexOfMessage++)
+  {
+    if (messages[indexOfMessage]->IsCriticalMessage())
+      return [self messageAtIndex:indexOfMessage inMessages:messages wrappedMessages:wrappedMessages];
+  }
+
+  return nil;
+}
+
++ (NSUInteger) passMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                      limit:(NSUInteger)limit
+           toMessageHandler:(SGFCMessageHandler)messageHandler
+{
+  NSUInteger numberOfMessages = std::min<NSUInteger>(messages.size(), limit);
+  for (NSUInteger indexOfMessage = 0; indexOfMessage < numberOfMessages; indexOfMessage++)
+  {
+    BOOL stop = NO;
+    messageHandler([SGFCWrappingUtility wrapMessage:messages[indexOfMessage]], &stop);
+    if (stop)
+      return indexOfMessage;
+  }
+
+  return NSNotFound;
+}
+
+#pragma mark - Private API
+
++ (SGFCMessage*) messageAtIndex:(NSUInteger)indexOfMessage
+                     inMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+                wrappedMessages:(NSArray*)wrappedMessages
+{
+  if (wrappedMessages)
+    return [wrappedMessages objectAtIndex:indexOfMessage];
+  else
+    return [SGFCWrappingUtility wrapMessage:messages[indexOfMessage]];
+}
+
+@end
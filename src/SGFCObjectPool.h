@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+/// @brief The SGFCObjectPool class manages a pool of reusable objects that
+/// can be acquired and relinquished from any thread.
+///
+/// @ingroup internals
+/// @ingroup library-support
+///
+/// SGFCObjectPool knows nothing about the objects it manages. It uses a
+/// factory block to create new objects when the pool is empty, and a reset
+/// block to prepare relinquished objects for reuse. Relinquished objects
+/// that exceed the maximum pool size are discarded.
+@interface SGFCObjectPool : NSObject
+{
+}
+
+/// @brief Do @b NOT use this initializer.
+- (instancetype) init NS_UNAVAILABLE;
+
+/// @brief Initializes an SGFCObjectPool object that keeps at most
+/// @a maximumPoolSize idle objects. The pool is initially empty.
+///
+/// This is the designated initializer of SGFCObjectPool.
+///
+/// @param factoryBlock Is invoked to create a new object if an object is
+/// acquired while the pool is empty. Must return a non-nil object.
+/// @param resetBlock Is invoked when an object is relinquished, before it
+/// is put back into the pool.
+///
+/// @exception NSInvalidArgumentException Is raised if @a factoryBlock or
+/// @a resetBlock is @e nil.
+- (instancetype) initWithMaximumPoolSize:(NSUInteger)maximumPoolSize
+                            factoryBlock:(id (^)(void))factoryBlock
+                              resetBlock:(void (^)(id object))resetBlock NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the maximum number of idle objects that the pool keeps.
+@property(nonatomic, readonly) NSUInteger maximumPoolSize;
+
+/// @brief Returns the number of idle objects that are currently in the
+/// pool.
+@property(nonatomic, readonly) NSUInteger numberOfIdleObjects;
+
+/// @brief Returns the number of times that acquireObject() has been
+/// invoked.
+@property(nonatomic, readonly) NSUInteger numberOfAcquisitions;
+
+/// @brief Returns the number of times that acquireObject() returned an
+/// idle object from the pool instead of creating a new object.
+@property(nonatomic, readonly) NSUInteger numberOfHits;
+
+/// @brief Returns numberOfHits() divided by numberOfAcquisitions(). Returns
+/// 0.0 if numberOfAcquisitions() is 0.
+@property(nonatomic, readonly) double hitRate;
+
+/// @brief Removes an idle object from the pool and returns it. Creates a
+/// new object if the pool is empty.
+- (id) acquireObject;
+
+/// @brief Resets @a object and puts it back into the pool. Discards
+/// @a object if the pool already contains maximumPoolSize() idle objects.
+///
+/// @exception NSInvalidArgumentException Is raised if @a object is @e nil,
+/// if @a object was not acquired from this pool, or if @a object has already
+/// been relinquished since it was last acquired.
+- (void) relinquishObject:(id)object;
+
+@end
@@ -0,0 +1,175 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCExceptionUtility.h"
+#import "SGFCObjectPool.h"
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSHashTable.h>
+
+// C++ Standard Library includes
+#import <mutex>
+
+#pragma mark - Class extension
+
+@interface SGFCObjectPool()
+{
+  std::mutex _mutex;
+  NSMutableArray* _idleObjects;
+  // Weak, so that objects that are never relinquished are not kept alive
+  NSHashTable* _acquiredObjects;
+  NSUInteger _numberOfAcquisitions;
+  NSUInteger _numberOfHits;
+}
+
+@property(nonatomic, readwrite) NSUInteger maximumPoolSize;
+@property(nonatomic, copy) id (^factoryBlock)(void);
+@property(nonatomic, copy) void (^resetBlock)(id object);
+
+@end
+
+@implementation SGFCObjectPool
+
+#pragma mark - Initialization and deallocation
+
+- (instancetype) initWithMaximumPoolSize:(NSUInteger)maximumPoolSize
+                            factoryBlock:(id (^)(void))factoryBlock
+                              resetBlock:(void (^)(id object))resetBlock
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:factoryBlock
+                                                 invalidArgumentName:@"factoryBlock"];
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:resetBlock
+                                                 invalidArgumentName:@"resetBlock"];
+
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  _idleObjects = [NSMutableArray arrayWithCapacity:maximumPoolSize];
+  _acquiredObjects = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality];
+  _numberOfAcquisitions = 0;
+  _numberOfHits = 0;
+
+  self.maximumPoolSize = maximumPoolSize;
+  self.factoryBlock = factoryBlock;
+  self.resetBlock = resetBlock;
+
+  return self;
+}
+
+- (void) dealloc
+{
+  _idleObjects = nil;
+  _acquiredObjects = nil;
+  self.factoryBlock = nil;
+  self.resetBlock = nil;
+}
+
+#pragma mark - Public API
+
+- (NSUInteger) numberOfIdleObjects
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _idleObjects.count;
+}
+
+- (NSUInteger) numberOfAcquisitions
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _numberOfAcquisitions;
+}
+
+- (NSUInteger) numberOfHits
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _numberOfHits;
+}
+
+- (double) hitRate
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_numberOfAcquisitions == 0)
+    return 0.0;
+  else
+    return static_cast<double>(_numberOfHits) / _numberOfAcquisitions;
+}
+
+- (id) acquireObject
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _numberOfAcquisitions++;
+
+    id object = _idleObjects.lastObject;
+    if (object)
+    {
+      [_idleObjects removeLastObject];
+      [_acquiredObjects addObject:object];
+      _numberOfHits++;
+      return object;
+    }
+  }
+
+  // Create the object outside of the lock, so that other threads are not
+  // blocked by the potentially expensive factory block
+  id object = self.factoryBlock();
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    [_acquiredObjects addObject:object];
+  }
+
+  return object;
+}
+
+- (void) relinquishObject:(id)object
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:object
+                                                 invalidArgumentName:@"object"];
+
+  // Check and remove under the same lock, otherwise two threads that
+  // relinquish the same object at the same time could both pass the check.
+  // The check must come before the reset: An object that is relinquished a
+  // second time may already have been acquired again by another client.
+  bool isAcquired;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    isAcquired = [_acquiredObjects containsObject:object];
+    if (isAcquired)
+      [_acquiredObjects removeObject:object];
+  }
+
+  if (! isAcquired)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"object\" was not acquired from this pool, or has already been relinquished"];
+
+  // Reset the object outside of the lock, for the same reason as in
+  // acquireObject. The object is neither acquired nor idle at this point,
+  // so no other client can use it while it is being reset.
+  self.resetBlock(object);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_idleObjects.count < self.maximumPoolSize)
+      [_idleObjects addObject:object];
+  }
+}
+
+@end
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+
+// C++ Standard Library includes
+#import <memory>
+#import <string>
+
+// System includes
+#import <Foundation/NSObject.h>
+
+/// @brief The SGFCTrustedInputParser class is a container for functions
+/// that parse SGF content into a libsgfc++ object tree without passing the
+/// SGF content through SGFC.
+///
+/// @ingroup internals
+/// @ingroup sgfc-frontend
+///
+/// All functions in SGFCTrustedInputParser are class methods, so there is
+/// no need to create an instance of SGFCTrustedInputParser.
+///
+/// SGFCTrustedInputParser handles only SGF content that SGFC would accept
+/// without changes, i.e. content that was previously normalized by SGFC.
+/// It does not check or repair the content the way SGFC does, it merely
+/// refuses to handle content that is outside of the narrow subset that it
+/// supports:
+/// - All games must be Go games (GM[1]) in file format FF[4] whose root
+///   node has the CA property value "UTF-8".
+/// - Only the properties that the SGF standard defines for FF4 and for Go
+///   are supported. Custom properties are not supported.
+/// - Property values must have the exact format that SGFC generates.
+///   Compressed point lists are not supported.
+/// - There must be no content outside of the game trees.
+@interface SGFCTrustedInputParser : NSObject
+{
+}
+
+/// @brief Parses @a sgfContent and returns a newly constructed libsgfc++
+/// document object that contains the games in @a sgfContent. Returns
+/// @e nullptr if @a sgfContent is not in the subset of SGF content that
+/// SGFCTrustedInputParser supports. In that case the caller must pass
+/// @a sgfContent through SGFC.
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>) parseSgfContent:(const std::string&)sgfContent;
+
+@end
@@ -0,0 +1,930 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "SGFCTrustedInputParser.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcColorPropertyValue.h>
+#import <libsgfcplusplus/ISgfcComposedPropertyValue.h>
+#import <libsgfcplusplus/ISgfcDoublePropertyValue.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+#import <libsgfcplusplus/ISgfcPropertyFactory.h>
+#import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
+#import <libsgfcplusplus/ISgfcSinglePropertyValue.h>
+#import <libsgfcplusplus/ISgfcTreeBuilder.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// System includes
+#import <xlocale.h>
+
+// C++ Standard Library includes
+#import <cctype>
+#import <cstdlib>
+#import <limits>
+#import <stdexcept>
+#import <unordered_map>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  const size_t noNodeIndex = std::numeric_limits<size_t>::max();
+
+  // The SGF standard defines that a Go board has at most 52 columns and rows
+  const LibSgfcPlusPlus::SgfcNumber maximumGoBoardSize = 52;
+
+  // The SGF standard defines that on a board with at most 19 columns and
+  // rows the move value "tt" is a pass move. libsgfc++ handles this
+  // differently depending on the board size, so the parser leaves this to
+  // SGFC.
+  const LibSgfcPlusPlus::SgfcNumber maximumBoardSizeWithPassMoveTT = 19;
+
+  // The value types that the parser supports
+  enum class ValueType
+  {
+    Number,
+    Real,
+    Double,
+    Color,
+    SimpleText,
+    Text,
+    GoPoint,
+    GoMove,
+    GoStone,
+  };
+
+  // How many values a property has according to the SGF standard
+  enum class ValueMultiplicity
+  {
+    // The property has a single empty value, i.e. value type "none"
+    None,
+    // The property has exactly one value
+    Single,
+    // The property has either a single empty value, or exactly one value
+    SingleOrNone,
+    // The property has one or more values, i.e. "list of"
+    List,
+    // The property has either a single empty value, or one or more values,
+    // i.e. "elist of"
+    Elist,
+  };
+
+  struct PropertyDefinition
+  {
+    ValueMultiplicity Multiplicity;
+    ValueType ValueType1;
+    // Only used if IsComposed is true
+    ValueType ValueType2;
+    bool IsComposed;
+    // If true a value may be either a composed value or a single value of
+    // ValueType1
+    bool IsCompositionOptional;
+    bool IsRootProperty;
+    // Only used for ValueType::GoMove and ValueType::GoStone
+    LibSgfcPlusPlus::SgfcColor Color;
+  };
+
+  PropertyDefinition Define(ValueMultiplicity multiplicity,
+                            ValueType valueType,
+                            LibSgfcPlusPlus::SgfcColor color = LibSgfcPlusPlus::SgfcColor::Black)
+  {
+    return { multiplicity, valueType, valueType, false, false, false, color };
+  }
+
+  PropertyDefinition DefineComposed(ValueMultiplicity multiplicity,
+                                    ValueType valueType1,
+                                    ValueType valueType2)
+  {
+    return { multiplicity, valueType1, valueType2, true, false, false, LibSgfcPlusPlus::SgfcColor::Black };
+  }
+
+  PropertyDefinition DefineRoot(PropertyDefinition propertyDefinition)
+  {
+    propertyDefinition.IsRootProperty = true;
+    return propertyDefinition;
+  }
+
+  // Returns the definitions of the properties that the parser supports,
+  // keyed by property name. These are the properties that the SGF standard
+  // defines for FF4 and for Go, with the value types that libsgfc++ uses
+  // for them.
+  const std::unordered_map<std::string, PropertyDefinition>& GetPropertyDefinitions()
+  {
+    static const std::unordered_map<std::string, PropertyDefinition> propertyDefinitions = []()
+    {
+      std::unordered_map<std::string, PropertyDefinition> definitions;
+
+      // Move properties
+      definitions["B"] = Define(ValueMultiplicity::Single, ValueType::GoMove, LibSgfcPlusPlus::SgfcColor::Black);
+      definitions["W"] = Define(ValueMultiplicity::Single, ValueType::GoMove, LibSgfcPlusPlus::SgfcColor::White);
+      definitions["KO"] = Define(ValueMultiplicity::None, ValueType::Number);
+      definitions["MN"] = Define(ValueMultiplicity::Single, ValueType::Number);
+
+      // Setup properties
+      definitions["AB"] = Define(ValueMultiplicity::List, ValueType::GoStone, LibSgfcPlusPlus::SgfcColor::Black);
+      definitions["AW"] = Define(ValueMultiplicity::List, ValueType::GoStone, LibSgfcPlusPlus::SgfcColor::White);
+      definitions["AE"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+      definitions["PL"] = Define(ValueMultiplicity::Single, ValueType::Color);
+
+      // Node annotation properties
+      definitions["C"] = Define(ValueMultiplicity::Single, ValueType::Text);
+      definitions["DM"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["GB"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["GW"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["HO"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["N"] = Define(ValueMultiplicity::Single, ValueType::SimpleText);
+      definitions["UC"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["V"] = Define(ValueMultiplicity::Single, ValueType::Real);
+
+      // Move annotation properties
+      definitions["BM"] = Define(ValueMultiplicity::Single, ValueType::Double);
+      definitions["DO"] = Define(ValueMultiplicity::None, ValueType::Number);
+      definitions["IT"] = Define(ValueMultiplicity::None, ValueType::Number);
+      definitions["TE"] = Define(ValueMultiplicity::Single, ValueType::Double);
+
+      // Markup properties
+      definitions["AR"] = DefineComposed(ValueMultiplicity::List, ValueType::GoPoint, ValueType::GoPoint);
+      definitions["CR"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+      definitions["DD"] = Define(ValueMultiplicity::Elist, ValueType::GoPoint);
+      definitions["LB"] = DefineComposed(ValueMultiplicity::List, ValueType::GoPoint, ValueType::SimpleText);
+      definitions["LN"] = DefineComposed(ValueMultiplicity::List, ValueType::GoPoint, ValueType::GoPoint);
+      definitions["MA"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+      definitions["SL"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+      definitions["SQ"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+      definitions["TR"] = Define(ValueMultiplicity::List, ValueType::GoPoint);
+
+      // Root properties
+      definitions["AP"] = DefineRoot(DefineComposed(ValueMultiplicity::Single, ValueType::SimpleText, ValueType::SimpleText));
+      definitions["CA"] = DefineRoot(Define(ValueMultiplicity::Single, ValueType::SimpleText));
+      definitions["FF"] = DefineRoot(Define(ValueMultiplicity::Single, ValueType::Number));
+      definitions["GM"] = DefineRoot(Define(ValueMultiplicity::Single, ValueType::Number));
+      definitions["ST"] = DefineRoot(Define(ValueMultiplicity::Single, ValueType::Number));
+      PropertyDefinition boardSizeDefinition = DefineComposed(ValueMultiplicity::Single, ValueType::Number, ValueType::Number);
+      boardSizeDefinition.IsCompositionOptional = true;
+      definitions["SZ"] = DefineRoot(boardSizeDefinition);
+
+      // Game info properties
+      for (const char* propertyName : { "AN", "BR", "BT", "CP", "DT", "EV", "GN", "ON", "OT", "PB", "PC", "PW", "RE", "RO", "RU", "SO", "US", "WR", "WT" })
+        definitions[propertyName] = Define(ValueMultiplicity::Single, ValueType::SimpleText);
+      definitions["GC"] = Define(ValueMultiplicity::Single, ValueType::Text);
+      definitions["HA"] = Define(ValueMultiplicity::Single, ValueType::Number);
+      definitions["KM"] = Define(ValueMultiplicity::Single, ValueType::Real);
+      definitions["TM"] = Define(ValueMultiplicity::Single, ValueType::Real);
+
+      // Timing properties
+      definitions["BL"] = Define(ValueMultiplicity::Single, ValueType::Real);
+      definitions["OB"] = Define(ValueMultiplicity::Single, ValueType::Number);
+      definitions["OW"] = Define(ValueMultiplicity::Single, ValueType::Number);
+      definitions["WL"] = Define(ValueMultiplicity::Single, ValueType::Real);
+
+      // Miscellaneous properties
+      definitions["FG"] = DefineComposed(ValueMultiplicity::SingleOrNone, ValueType::Number, ValueType::SimpleText);
+      definitions["PM"] = Define(ValueMultiplicity::Single, ValueType::Number);
+      definitions["VW"] = Define(ValueMultiplicity::Elist, ValueType::GoPoint);
+
+      // Go properties
+      definitions["TB"] = Define(ValueMultiplicity::Elist, ValueType::GoPoint);
+      definitions["TW"] = Define(ValueMultiplicity::Elist, ValueType::GoPoint);
+
+      return definitions;
+    }();
+
+    return propertyDefinitions;
+  }
+
+  // A property as it appears in the SGF content. The values are raw, i.e.
+  // they still contain escape characters.
+  struct RawProperty
+  {
+    std::string Name;
+    std::vector<std::string> RawValues;
+  };
+
+  struct RawNode
+  {
+    std::vector<RawProperty> Properties;
+    size_t FirstChildIndex = noNodeIndex;
+    size_t LastChildIndex = noNodeIndex;
+    size_t NextSiblingIndex = noNodeIndex;
+  };
+
+  // The nodes of a game, in the order in which they appear in the SGF
+  // content. The first node is the root node.
+  typedef std::vector<RawNode> RawGame;
+
+  // A game tree, i.e. a sequence of nodes followed by zero or more
+  // variations, that the parser is currently processing
+  struct GameTreeFrame
+  {
+    // The node that the first node of the game tree is attached to
+    size_t ParentNodeIndex;
+    // The node that was most recently added to the sequence
+    size_t LastNodeIndex;
+    bool HasVariations;
+  };
+
+  bool IsWhitespace(char character)
+  {
+    return (character == ' ' || character == '\n' || character == '\r' || character == '\t');
+  }
+
+  void SkipWhitespace(const std::string& sgfContent, size_t& position)
+  {
+    while (position < sgfContent.size() && IsWhitespace(sgfContent[position]))
+      position++;
+  }
+
+  void AppendChild(RawGame& rawGame, size_t parentNodeIndex, size_t childNodeIndex)
+  {
+    RawNode& parentNode = rawGame[parentNodeIndex];
+    if (parentNode.FirstChildIndex == noNodeIndex)
+      parentNode.FirstChildIndex = childNodeIndex;
+    else
+      rawGame[parentNode.LastChildIndex].NextSiblingIndex = childNodeIndex;
+    parentNode.LastChildIndex = childNodeIndex;
+  }
+
+  // Parses the property that starts at @a position and adds it to
+  // @a rawNode. Returns false if the property is malformed.
+  bool ParseProperty(const std::string& sgfContent, size_t& position, RawNode& rawNode)
+  {
+    size_t nameStartPosition = position;
+    while (position < sgfContent.size() && sgfContent[position] >= 'A' && sgfContent[position] <= 'Z')
+      position++;
+
+    RawProperty rawProperty;
+    rawProperty.Name = sgfContent.substr(nameStartPosition, position - nameStartPosition);
+
+    while (true)
+    {
+      SkipWhitespace(sgfContent, position);
+      if (position == sgfContent.size() || sgfContent[position] != '[')
+        break;
+
+      size_t valueStartPosition = ++position;
+      while (position < sgfContent.size() && sgfContent[position] != ']')
+      {
+        // Skip the escaped character
+        if (sgfContent[position] == '\\')
+          position++;
+        position++;
+      }
+
+      if (position >= sgfContent.size())
+        return false;
+
+      rawProperty.RawValues.push_back(sgfContent.substr(valueStartPosition, position - valueStartPosition));
+      position++;
+    }
+
+    if (rawProperty.RawValues.empty())
+      return false;
+
+    rawNode.Properties.push_back(std::move(rawProperty));
+    return true;
+  }
+
+  // Parses the game trees in @a sgfContent and adds them to @a rawGames.
+  // Returns false if @a sgfContent is malformed, or if it contains anything
+  // outside of the game trees. Nested game trees are processed with an
+  // explicit stack so that deeply nested variations cannot overflow the
+  // call stack.
+  bool ParseCollection(const std::string& sgfContent, std::vector<RawGame>& rawGames)
+  {
+    std::vector<GameTreeFrame> frames;
+    size_t position = 0;
+
+    while (true)
+    {
+      SkipWhitespace(sgfContent, position);
+      if (position == sgfContent.size())
+        break;
+
+      char character = sgfContent[position];
+
+      if (frames.empty())
+      {
+        if (character != '(')
+          return false;
+
+        rawGames.emplace_back();
+        frames.push_back({ noNodeIndex, noNodeIndex, false });
+        position++;
+        continue;
+      }
+
+      RawGame& rawGame = rawGames.back();
+      GameTreeFrame& frame = frames.back();
+
+      if (character == '(')
+      {
+        // A variation requires a preceding sequence
+        if (frame.LastNodeIndex == noNodeIndex)
+          return false;
+
+        frame.HasVariations = true;
+        size_t parentNodeIndex = frame.LastNodeIndex;
+        frames.push_back({ parentNodeIndex, noNodeIndex, false });
+        position++;
+      }
+      else if (character == ')')
+      {
+        // A game tree requires at least one node
+        if (frame.LastNodeIndex == noNodeIndex)
+          return false;
+
+        frames.pop_back();
+        position++;
+      }
+      else if (character == ';')
+      {
+        // A sequence cannot continue after a variation
+        if (frame.HasVariations)
+          return false;
+
+        size_t parentNodeIndex = (frame.LastNodeIndex != noNodeIndex) ? frame.LastNodeIndex : frame.ParentNodeIndex;
+        size_t nodeIndex = rawGame.size();
+        rawGame.emplace_back();
+        if (parentNodeIndex != noNodeIndex)
+          AppendChild(rawGame, parentNodeIndex, nodeIndex);
+
+        frame.LastNodeIndex = nodeIndex;
+        position++;
+      }
+      else if (character >= 'A' && character <= 'Z')
+      {
+        if (frame.LastNodeIndex == noNodeIndex || frame.HasVariations)
+          return false;
+
+        if (! ParseProperty(sgfContent, position, rawGame[frame.LastNodeIndex]))
+          return false;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    return (frames.empty() && ! rawGames.empty());
+  }
+
+  // Returns the position of the first ':' in @a rawValue that is not
+  // escaped, or std::string::npos if there is no such character.
+  size_t FindCompositionSeparator(const std::string& rawValue)
+  {
+    for (size_t position = 0; position < rawValue.size(); position++)
+    {
+      if (rawValue[position] == '\\')
+        position++;
+      else if (rawValue[position] == ':')
+        return position;
+    }
+
+    return std::string::npos;
+  }
+
+  // Removes the escape characters and the soft line breaks from
+  // @a rawValue. If @a isSimpleText is true, line breaks are converted to
+  // spaces. Returns false if @a rawValue contains whitespace characters
+  // other than spaces and newline characters, because SGFC would normalize
+  // them.
+  bool UnescapeText(const std::string& rawValue, bool isSimpleText, std::string& value)
+  {
+    value.clear();
+    value.reserve(rawValue.size());
+
+    for (size_t position = 0; position < rawValue.size(); position++)
+    {
+      char character = rawValue[position];
+      if (character == '\\')
+      {
+        position++;
+        if (position == rawValue.size())
+          return false;
+
+        character = rawValue[position];
+
+        // Soft line break
+        if (character == '\n')
+          continue;
+      }
+      else if (character == '\n' && isSimpleText)
+      {
+        character = ' ';
+      }
+
+      if (character == '\r' || character == '\t')
+        return false;
+
+      value.push_back(character);
+    }
+
+    return true;
+  }
+
+  bool ParseNumber(const std::string& rawValue, LibSgfcPlusPlus::SgfcNumber& number)
+  {
+    size_t position = 0;
+    if (position < rawValue.size() && (rawValue[position] == '+' || rawValue[position] == '-'))
+      position++;
+
+    // Limiting the number of digits prevents overflow
+    size_t numberOfDigits = rawValue.size() - position;
+    if (numberOfDigits == 0 || numberOfDigits > 9)
+      return false;
+
+    for (; position < rawValue.size(); position++)
+    {
+      if (rawValue[position] < '0' || rawValue[position] > '9')
+        return false;
+    }
+
+    number = static_cast<LibSgfcPlusPlus::SgfcNumber>(std::strtol(rawValue.c_str(), nullptr, 10));
+    return true;
+  }
+
+  bool ParseReal(const std::string& rawValue, LibSgfcPlusPlus::SgfcReal& real)
+  {
+    size_t position = 0;
+    if (position < rawValue.size() && (rawValue[position] == '+' || rawValue[position] == '-'))
+      position++;
+
+    size_t numberOfDigits = 0;
+    bool hasDecimalPoint = false;
+    for (; position < rawValue.size(); position++)
+    {
+      if (rawValue[position] >= '0' && rawValue[position] <= '9')
+        numberOfDigits++;
+      else if (rawValue[position] == '.' && ! hasDecimalPoint)
+        hasDecimalPoint = true;
+      else
+        return false;
+    }
+
+    if (numberOfDigits == 0)
+      return false;
+
+    // std::strtod() uses the decimal point character of the current locale,
+    // but SGF always uses '.'. Parse with the "C" locale so that the result
+    // does not depend on the locale that the process happens to use.
+    static const locale_t cLocale = newlocale(LC_ALL_MASK, "C", nullptr);
+    real = static_cast<LibSgfcPlusPlus::SgfcReal>(strtod_l(rawValue.c_str(), nullptr, cLocale));
+    return true;
+  }
+
+  // Returns the zero-based index that the SGF standard assigns to the
+  // Go coordinate letter @a letter, or -1 if @a letter is not a valid Go
+  // coordinate letter.
+  int GoCoordinateIndex(char letter)
+  {
+    if (letter >= 'a' && letter <= 'z')
+      return letter - 'a';
+    else if (letter >= 'A' && letter <= 'Z')
+      return letter - 'A' + 26;
+    else
+      return -1;
+  }
+
+  bool IsGoPointOnBoard(const std::string& rawValue, LibSgfcPlusPlus::SgfcBoardSize boardSize)
+  {
+    if (rawValue.size() != 2)
+      return false;
+
+    int columnIndex = GoCoordinateIndex(rawValue[0]);
+    int rowIndex = GoCoordinateIndex(rawValue[1]);
+
+    return (columnIndex >= 0 && columnIndex < boardSize.Columns &&
+            rowIndex >= 0 && rowIndex < boardSize.Rows);
+  }
+
+  // Converts @a rawValue to a libsgfc++ property value of type
+  // @a valueType. Returns nullptr if @a rawValue cannot be converted, or if
+  // SGFC would convert it differently.
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcSinglePropertyValue> CreateSinglePropertyValue(const std::string& rawValue,
+                                                                                       ValueType valueType,
+                                                                                       LibSgfcPlusPlus::SgfcColor color,
+                                                                                       LibSgfcPlusPlus::SgfcBoardSize boardSize,
+                                                                                       LibSgfcPlusPlus::ISgfcPropertyValueFactory& propertyValueFactory)
+  {
+    switch (valueType)
+    {
+      case ValueType::Number:
+      {
+        LibSgfcPlusPlus::SgfcNumber number;
+        if (! ParseNumber(rawValue, number))
+          return nullptr;
+        return propertyValueFactory.CreateNumberPropertyValue(number);
+      }
+      case ValueType::Real:
+      {
+        LibSgfcPlusPlus::SgfcReal real;
+        if (! ParseReal(rawValue, real))
+          return nullptr;
+        return propertyValueFactory.CreateRealPropertyValue(real);
+      }
+      case ValueType::Double:
+      {
+        if (rawValue == "1")
+          return propertyValueFactory.CreateDoublePropertyValue(LibSgfcPlusPlus::SgfcDouble::Normal);
+        else if (rawValue == "2")
+          return propertyValueFactory.CreateDoublePropertyValue(LibSgfcPlusPlus::SgfcDouble::Emphasized);
+        else
+          return nullptr;
+      }
+      case ValueType::Color:
+      {
+        if (rawValue == "B")
+          return propertyValueFactory.CreateColorPropertyValue(LibSgfcPlusPlus::SgfcColor::Black);
+        else if (rawValue == "W")
+          return propertyValueFactory.CreateColorPropertyValue(LibSgfcPlusPlus::SgfcColor::White);
+        else
+          return nullptr;
+      }
+      case ValueType::SimpleText:
+      case ValueType::Text:
+      {
+        std::string value;
+        if (! UnescapeText(rawValue, valueType == ValueType::SimpleText, value))
+          return nullptr;
+
+        if (valueType == ValueType::SimpleText)
+          return propertyValueFactory.CreateSimpleTextPropertyValue(value);
+        else
+          return propertyValueFactory.CreateTextPropertyValue(value);
+      }
+      case ValueType::GoPoint:
+      {
+        if (! IsGoPointOnBoard(rawValue, boardSize))
+          return nullptr;
+        return propertyValueFactory.CreateGoPointPropertyValue(rawValue, boardSize);
+      }
+      case ValueType::GoMove:
+      {
+        if (rawValue.empty())
+          return propertyValueFactory.CreateGoMovePropertyValue(color);
+
+        if (rawValue == "tt" &&
+            boardSize.Columns <= maximumBoardSizeWithPassMoveTT &&
+            boardSize.Rows <= maximumBoardSizeWithPassMoveTT)
+        {
+          return nullptr;
+        }
+
+        if (! IsGoPointOnBoard(rawValue, boardSize))
+          return nullptr;
+        return propertyValueFactory.CreateGoMovePropertyValue(rawValue, boardSize, color);
+      }
+      case ValueType::GoStone:
+      {
+        if (! IsGoPointOnBoard(rawValue, boardSize))
+          return nullptr;
+        return propertyValueFactory.CreateGoStonePropertyValue(rawValue, boardSize, color);
+      }
+    }
+
+    return nullptr;
+  }
+
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue> CreatePropertyValue(const std::string& rawValue,
+                                                                           const PropertyDefinition& propertyDefinition,
+                                                                           LibSgfcPlusPlus::SgfcBoardSize boardSize,
+                                                                           LibSgfcPlusPlus::ISgfcPropertyValueFactory& propertyValueFactory)
+  {
+    if (propertyDefinition.IsComposed)
+    {
+      size_t separatorPosition = FindCompositionSeparator(rawValue);
+      if (separatorPosition == std::string::npos)
+      {
+        if (! propertyDefinition.IsCompositionOptional)
+          return nullptr;
+      }
+      else
+      {
+        auto value1 = CreateSinglePropertyValue(rawValue.substr(0, separatorPosition),
+                                                propertyDefinition.ValueType1,
+                                                propertyDefinition.Color,
+                                                boardSize,
+                                                propertyValueFactory);
+        auto value2 = CreateSinglePropertyValue(rawValue.substr(separatorPosition + 1),
+                                                propertyDefinition.ValueType2,
+                                                propertyDefinition.Color,
+                                                boardSize,
+                                                propertyValueFactory);
+        if (value1 == nullptr || value2 == nullptr)
+          return nullptr;
+
+        return propertyValueFactory.CreateCustomComposedPropertyValue(value1, value2);
+      }
+    }
+    else if (FindCompositionSeparator(rawValue) != std::string::npos &&
+             propertyDefinition.ValueType1 != ValueType::SimpleText &&
+             propertyDefinition.ValueType1 != ValueType::Text)
+    {
+      // E.g. a compressed point list
+      return nullptr;
+    }
+
+    return CreateSinglePropertyValue(rawValue,
+                                     propertyDefinition.ValueType1,
+                                     propertyDefinition.Color,
+                                     boardSize,
+                                     propertyValueFactory);
+  }
+
+  // Converts the values of @a rawProperty to libsgfc++ property values and
+  // adds them to @a propertyValues. Returns false if the values do not
+  // match @a propertyDefinition.
+  bool CreatePropertyValues(const RawProperty& rawProperty,
+                            const PropertyDefinition& propertyDefinition,
+                            LibSgfcPlusPlus::SgfcBoardSize boardSize,
+                            LibSgfcPlusPlus::ISgfcPropertyValueFactory& propertyValueFactory,
+                            std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>& propertyValues)
+  {
+    const std::vector<std::string>& rawValues = rawProperty.RawValues;
+    bool isSingleEmptyValue = (rawValues.size() == 1 && rawValues.front().empty());
+
+    switch (propertyDefinition.Multiplicity)
+    {
+      case ValueMultiplicity::None:
+        return isSingleEmptyValue;
+      case ValueMultiplicity::SingleOrNone:
+      case ValueMultiplicity::Elist:
+        if (isSingleEmptyValue)
+          return true;
+        break;
+      default:
+        break;
+    }
+
+    switch (propertyDefinition.Multiplicity)
+    {
+      case ValueMultiplicity::Single:
+      case ValueMultiplicity::SingleOrNone:
+        if (rawValues.size() != 1)
+          return false;
+        break;
+      default:
+        break;
+    }
+
+    propertyValues.reserve(rawValues.size());
+    for (const std::string& rawValue : rawValues)
+    {
+      auto propertyValue = CreatePropertyValue(rawValue, propertyDefinition, boardSize, propertyValueFactory);
+      if (propertyValue == nullptr)
+        return false;
+
+      propertyValues.push_back(propertyValue);
+    }
+
+    return true;
+  }
+
+  const RawProperty* FindProperty(const RawNode& rawNode, const std::string& propertyName)
+  {
+    for (const RawProperty& rawProperty : rawNode.Properties)
+    {
+      if (rawProperty.Name == propertyName)
+        return &rawProperty;
+    }
+
+    return nullptr;
+  }
+
+  bool HasSingleRawValue(const RawProperty* rawProperty, const std::string& rawValue)
+  {
+    return (rawProperty != nullptr &&
+            rawProperty->RawValues.size() == 1 &&
+            rawProperty->RawValues.front() == rawValue);
+  }
+
+  bool IsUtf8EncodingName(const std::string& encodingName)
+  {
+    static const std::string utf8EncodingName = "UTF-8";
+    if (encodingName.size() != utf8EncodingName.size())
+      return false;
+
+    for (size_t index = 0; index < encodingName.size(); index++)
+    {
+      if (std::toupper(static_cast<unsigned char>(encodingName[index])) != utf8EncodingName[index])
+        return false;
+    }
+
+    return true;
+  }
+
+  // Checks the root node properties that determine whether the parser can
+  // handle the game, and determines the board size of the game. Returns
+  // false if the parser cannot handle the game.
+  bool ExamineRootNode(const RawNode& rootNode, LibSgfcPlusPlus::SgfcBoardSize& boardSize)
+  {
+    if (! HasSingleRawValue(FindProperty(rootNode, "GM"), "1") ||
+        ! HasSingleRawValue(FindProperty(rootNode, "FF"), "4"))
+    {
+      return false;
+    }
+
+    const RawProperty* encodingProperty = FindProperty(rootNode, "CA");
+    if (encodingProperty == nullptr ||
+        encodingProperty->RawValues.size() != 1 ||
+        ! IsUtf8EncodingName(encodingProperty->RawValues.front()))
+    {
+      return false;
+    }
+
+    // The SGF standard defines 19x19 as the default board size for Go
+    boardSize.Columns = 19;
+    boardSize.Rows = 19;
+
+    const RawProperty* boardSizeProperty = FindProperty(rootNode, "SZ");
+    if (boardSizeProperty != nullptr)
+    {
+      if (boardSizeProperty->RawValues.size() != 1)
+        return false;
+
+      const std::string& rawValue = boardSizeProperty->RawValues.front();
+      size_t separatorPosition = FindCompositionSeparator(rawValue);
+      if (separatorPosition == std::string::npos)
+      {
+        if (! ParseNumber(rawValue, boardSize.Columns))
+          return false;
+        boardSize.Rows = boardSize.Columns;
+      }
+      else
+      {
+        if (! ParseNumber(rawValue.substr(0, separatorPosition), boardSize.Columns) ||
+            ! ParseNumber(rawValue.substr(separatorPosition + 1), boardSize.Rows))
+        {
+          return false;
+        }
+
+        // SGFC writes square board sizes as a single value
+        if (boardSize.Columns == boardSize.Rows)
+          return false;
+      }
+
+      if (boardSize.Columns < 1 || boardSize.Columns > maximumGoBoardSize ||
+          boardSize.Rows < 1 || boardSize.Rows > maximumGoBoardSize)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // Converts the properties of @a rawNode to libsgfc++ properties and adds
+  // them to @a properties. Returns false if the parser cannot handle one of
+  // the properties.
+  bool CreateProperties(const RawNode& rawNode,
+                        bool isRootNode,
+                        LibSgfcPlusPlus::SgfcBoardSize boardSize,
+                        LibSgfcPlusPlus::ISgfcPropertyFactory& propertyFactory,
+                        LibSgfcPlusPlus::ISgfcPropertyValueFactory& propertyValueFactory,
+                        std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>>& properties)
+  {
+    const std::unordered_map<std::string, PropertyDefinition>& propertyDefinitions = GetPropertyDefinitions();
+
+    properties.reserve(rawNode.Properties.size());
+    for (size_t propertyIndex = 0; propertyIndex < rawNode.Properties.size(); propertyIndex++)
+    {
+      const RawProperty& rawProperty = rawNode.Properties[propertyIndex];
+
+      auto it = propertyDefinitions.find(rawProperty.Name);
+      if (it == propertyDefinitions.end())
+        return false;
+
+      const PropertyDefinition& propertyDefinition = it->second;
+      if (propertyDefinition.IsRootProperty && ! isRootNode)
+        return false;
+
+      // SGFC would delete the duplicate. Nodes typically have only a few
+      // properties, so a linear search is good enough.
+      for (size_t otherPropertyIndex = 0; otherPropertyIndex < propertyIndex; otherPropertyIndex++)
+      {
+        if (rawNode.Properties[otherPropertyIndex].Name == rawProperty.Name)
+          return false;
+      }
+
+      std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>> propertyValues;
+      if (rawProperty.Name == "CA")
+      {
+        // SGFCDocumentReader writes the normalized encoding name into the
+        // root node after SGFC has read the content as UTF-8
+        propertyValues.push_back(propertyValueFactory.CreateSimpleTextPropertyValue("UTF-8"));
+      }
+      else if (! CreatePropertyValues(rawProperty, propertyDefinition, boardSize, propertyValueFactory, propertyValues))
+      {
+        return false;
+      }
+
+      properties.push_back(propertyFactory.CreateProperty(rawProperty.Name, propertyValues));
+    }
+
+    return true;
+  }
+}
+
+@implementation SGFCTrustedInputParser
+
+#pragma mark - Public API
+
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>) parseSgfContent:(const std::string&)sgfContent
+{
+  std::vector<RawGame> rawGames;
+  if (! ParseCollection(sgfContent, rawGames))
+    return nullptr;
+
+  auto propertyFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>> wrappedGames;
+  wrappedGames.reserve(rawGames.size());
+
+  try
+  {
+    for (const RawGame& rawGame : rawGames)
+    {
+      auto wrappedGame = [self createWrappedGameWithRawGame:rawGame
+                                            propertyFactory:*propertyFactory
+                                       propertyValueFactory:*propertyValueFactory];
+      if (wrappedGame == nullptr)
+        return nullptr;
+
+      wrappedGames.push_back(wrappedGame);
+    }
+  }
+  catch (std::invalid_argument&)
+  {
+    // libsgfc++ rejected a value that passed the parser's checks. Let SGFC
+    // deal with it.
+    return nullptr;
+  }
+
+  auto wrappedDocument = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument();
+  wrappedDocument->SetGames(wrappedGames);
+
+  return wrappedDocument;
+}
+
+#pragma mark - Private API
+
+// Returns a newly constructed libsgfc++ game object with the content of
+// @a rawGame, or nullptr if the parser cannot handle @a rawGame.
++ (std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>) createWrappedGameWithRawGame:(const RawGame&)rawGame
+                                                             propertyFactory:(LibSgfcPlusPlus::ISgfcPropertyFactory&)propertyFactory
+                                                        propertyValueFactory:(LibSgfcPlusPlus::ISgfcPropertyValueFactory&)propertyValueFactory
+{
+  LibSgfcPlusPlus::SgfcBoardSize boardSize;
+  if (! ExamineRootNode(rawGame.front(), boardSize))
+    return nullptr;
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> wrappedNodes;
+  wrappedNodes.reserve(rawGame.size());
+
+  for (size_t nodeIndex = 0; nodeIndex < rawGame.size(); nodeIndex++)
+  {
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>> wrappedProperties;
+    if (! CreateProperties(rawGame[nodeIndex], nodeIndex == 0, boardSize, propertyFactory, propertyValueFactory, wrappedProperties))
+      return nullptr;
+
+    auto wrappedNode = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateNode();
+    wrappedNode->SetProperties(wrappedProperties);
+    wrappedNodes.push_back(wrappedNode);
+  }
+
+  auto wrappedGame = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame(wrappedNodes.front());
+  auto wrappedTreeBuilder = wrappedGame->GetTreeBuilder();
+
+  // The nodes are stored in depth-first pre-order, so when we link a node
+  // to its next sibling, the node itself is already linked to its parent.
+  for (size_t nodeIndex = 0; nodeIndex < rawGame.size(); nodeIndex++)
+  {
+    const RawNode& rawNode = rawGame[nodeIndex];
+    if (rawNode.FirstChildIndex != noNodeIndex)
+      wrappedTreeBuilder->SetFirstChild(wrappedNodes[nodeIndex], wrappedNodes[rawNode.FirstChildIndex]);
+    if (rawNode.NextSiblingIndex != noNodeIndex)
+      wrappedTreeBuilder->SetNextSibling(wrappedNodes[nodeIndex], wrappedNodes[rawNode.NextSiblingIndex]);
+  }
+
+  return wrappedGame;
+}
+
+@end
@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// System includes
+#import <Foundation/NSObject.h>
+
+// C++ Standard Library includes
+#import <memory>
+
+// Forward declarations
+@class NSArray;
+@class SGFCGameHistory;
+
+namespace LibSgfcPlusPlus
+{
+  class ISgfcGame;
+  class ISgfcNode;
+}
+
+/// @brief The SGFCValidationCache class caches the SGFCValidationUtility
+/// findings for the nodes of a game tree, so that a game can be validated
+/// repeatedly without re-checking nodes that have not changed.
+///
+/// @ingroup internals
+/// @ingroup document
+///
+/// Each SGFCGame object owns an SGFCValidationCache object and passes it on
+/// to the SGFCNode and SGFCProperty objects that it hands out, in the same
+/// way as it passes on its SGFCGameHistory. These objects, and
+/// SGFCTreeBuilder, notify the cache whenever they modify the game tree.
+///
+/// For each node the cache remembers the node's own findings, the context
+/// in which the findings were generated (whether the node was the root node,
+/// and whether the node had an ancestor with game info properties), and the
+/// number of findings in the node's subtree. A change marks the node as
+/// dirty and the node and all of its ancestors as having a dirty subtree.
+/// validateWrappedGame:history:gameNumber:() re-checks only dirty nodes and
+/// nodes whose context has changed, and descends only into subtrees that are
+/// dirty or that contain findings. A clean subtree without findings is
+/// skipped entirely.
+///
+/// The cache is discarded when the game's SGFCGameHistory reverts or
+/// re-applies a version, because the history modifies the game tree without
+/// going through SGFCNode, SGFCProperty or SGFCTreeBuilder.
+@interface SGFCValidationCache : NSObject
+{
+}
+
+/// @brief Initializes an SGFCValidationCache object. The cache is initially
+/// empty.
+///
+/// This is the designated initializer of SGFCValidationCache.
+- (instancetype) init NS_DESIGNATED_INITIALIZER;
+
+/// @brief Returns the number of nodes that the most recent invocation of
+/// validateWrappedGame:history:gameNumber:() checked. The nodes whose
+/// findings were taken from the cache are not counted.
+@property(nonatomic, readonly) NSUInteger numberOfValidatedNodes;
+
+/// @brief Notifies the cache that the properties of @a wrappedNode, or the
+/// values of these properties, have changed. Does nothing if
+/// @a wrappedNode is @e nullptr or if the cache is empty.
+- (void) propertiesOfNodeDidChange:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)wrappedNode;
+
+/// @brief Notifies the cache that the children of @a wrappedNode have
+/// changed. Does nothing if @a wrappedNode is @e nullptr or if the cache is
+/// empty.
+- (void) childrenOfNodeDidChange:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)wrappedNode;
+
+/// @brief Validates @a wrappedGame and its game tree, using the cached
+/// findings of all nodes that have not changed since the previous
+/// invocation, and updates the cache.
+///
+/// @a wrappedGame must have a root node. @a history is the history of the
+/// game, or @e nil if the game has no history. The cache is discarded if
+/// @a history has reverted or re-applied a version since the previous
+/// invocation.
+///
+/// @return A collection of SGFCMessage objects, in the same order as if
+/// the game had been validated by SGFCDocumentValidator. The message texts
+/// refer to the game with the 1-based number @a gameNumber.
+- (NSArray*) validateWrappedGame:(const LibSgfcPlusPlus::ISgfcGame&)wrappedGame
+                          history:(SGFCGameHistory*)history
+                       gameNumber:(NSUInteger)gameNumber;
+
+@end
@@ -0,0 +1,314 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "interface/internal/SGFCGameHistoryInternalAdditions.h"
+#import "SGFCValidationCache.h"
+#import "SGFCValidationUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+#import <unordered_map>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // The cached validation state of a single node
+  struct NodeEntry
+  {
+    // Used to detect that the node was destroyed and that another node was
+    // created at the same address
+    std::weak_ptr<LibSgfcPlusPlus::ISgfcNode> Node;
+    // The context in which Findings were generated
+    bool IsRootNode = false;
+    bool HasGameInfoAncestor = false;
+    bool HasGameInfo = false;
+    bool IsNodeDirty = true;
+    bool IsSubtreeDirty = true;
+    std::vector<SGFCValidationFinding> Findings;
+    // The number of findings of all descendants of the node
+    size_t NumberOfDescendantFindings = 0;
+  };
+
+  // An entry on the stack of nodes that
+  // validateWrappedGame:history:gameNumber:() still has to visit
+  struct NodeToVisit
+  {
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> Node;
+    bool IsRootNode;
+    bool HasGameInfoAncestor;
+    // True if the children of the node have already been pushed onto the
+    // stack, i.e. if the entry is visited for the second time
+    bool ChildrenWerePushed;
+  };
+
+  // The cache does not prune entries for nodes that no longer exist until it
+  // has at least this many entries
+  const size_t minimumPruneThreshold = 1024;
+}
+
+#pragma mark - Class extension
+
+@interface SGFCValidationCache()
+{
+  std::unordered_map<const LibSgfcPlusPlus::ISgfcNode*, NodeEntry> _nodeEntries;
+  size_t _pruneThreshold;
+  // The value of the game history's undoRedoCount when the cache was last
+  // updated
+  NSUInteger _undoRedoCount;
+}
+
+@property(nonatomic, assign, readwrite) NSUInteger numberOfValidatedNodes;
+
+@end
+
+@implementation SGFCValidationCache
+
+#pragma mark - Initialization and deallocation
+
+- (instancetype) init
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  _pruneThreshold = minimumPruneThreshold;
+  self.numberOfValidatedNodes = 0;
+
+  return self;
+}
+
+#pragma mark - Public API
+
+- (void) propertiesOfNodeDidChange:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)wrappedNode
+{
+  if (wrappedNode == nullptr || _nodeEntries.empty())
+    return;
+
+  auto it = _nodeEntries.find(wrappedNode.get());
+  if (it != _nodeEntries.end())
+    it->second.IsNodeDirty = true;
+
+  [self markSubtreeDirtyStartingAtNode:wrappedNode];
+}
+
+- (void) childrenOfNodeDidChange:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)wrappedNode
+{
+  if (wrappedNode == nullptr || _nodeEntries.empty())
+    return;
+
+  [self markSubtreeDirtyStartingAtNode:wrappedNode];
+}
+
+- (NSArray*) validateWrappedGame:(const LibSgfcPlusPlus::ISgfcGame&)wrappedGame
+                          history:(SGFCGameHistory*)history
+                       gameNumber:(NSUInteger)gameNumber
+{
+  // An undo or redo modifies the game tree behind our back
+  NSUInteger undoRedoCount = [history undoRedoCount];
+  if (_undoRedoCount != undoRedoCount)
+  {
+    _nodeEntries.clear();
+    _undoRedoCount = undoRedoCount;
+  }
+
+  NSUInteger numberOfValidatedNodes = 0;
+  std::vector<SGFCValidationFinding> findings;
+
+  [SGFCValidationUtility validateWrappedGame:wrappedGame findings:findings];
+
+  // Iterate instead of recursing so that deep trees (e.g. long games without
+  // variations) cannot overflow the stack. A node whose subtree must be
+  // visited stays on the stack while its children are visited, so that the
+  // number of findings in its subtree can be updated afterwards. Children
+  // are pushed in reverse order so that they are visited in document order.
+  std::vector<NodeToVisit> nodesToVisit;
+  nodesToVisit.push_back({ wrappedGame.GetRootNode(), true, false, false });
+
+  while (! nodesToVisit.empty())
+  {
+    NodeToVisit& nodeToVisit = nodesToVisit.back();
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> node = nodeToVisit.Node;
+
+    if (nodeToVisit.ChildrenWerePushed)
+    {
+      NodeEntry& nodeEntry = _nodeEntries[node.get()];
+      nodeEntry.NumberOfDescendantFindings = 0;
+      for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+      {
+        const NodeEntry& childEntry = _nodeEntries[child.get()];
+        nodeEntry.NumberOfDescendantFindings += childEntry.Findings.size() + childEntry.NumberOfDescendantFindings;
+      }
+      nodeEntry.IsSubtreeDirty = false;
+
+      nodesToVisit.pop_back();
+      continue;
+    }
+
+    bool isRootNode = nodeToVisit.IsRootNode;
+    bool hasGameInfoAncestor = nodeToVisit.HasGameInfoAncestor;
+
+    // References to the elements of an unordered_map remain valid when
+    // other elements are inserted
+    NodeEntry& nodeEntry = [self nodeEntryForNode:node];
+    bool previousChildrenHaveGameInfoAncestor = nodeEntry.HasGameInfoAncestor || nodeEntry.HasGameInfo;
+
+    if (nodeEntry.IsNodeDirty ||
+        nodeEntry.IsRootNode != isRootNode ||
+        nodeEntry.HasGameInfoAncestor != hasGameInfoAncestor)
+    {
+      nodeEntry.Findings.clear();
+      nodeEntry.HasGameInfo = [SGFCValidationUtility validateWrappedNode:*node
+                                                              isRootNode:isRootNode
+                                                     hasGameInfoAncestor:hasGameInfoAncestor
+                                                                findings:nodeEntry.Findings];
+      nodeEntry.IsRootNode = isRootNode;
+      nodeEntry.HasGameInfoAncestor = hasGameInfoAncestor;
+      nodeEntry.IsNodeDirty = false;
+      numberOfValidatedNodes++;
+    }
+
+    findings.insert(findings.end(), nodeEntry.Findings.begin(), nodeEntry.Findings.end());
+
+    bool childrenHaveGameInfoAncestor = hasGameInfoAncestor || nodeEntry.HasGameInfo;
+    if (! nodeEntry.IsSubtreeDirty && childrenHaveGameInfoAncestor == previousChildrenHaveGameInfoAncestor)
+    {
+      if (nodeEntry.NumberOfDescendantFindings > 0)
+        [self appendCachedFindingsOfDescendantsOfNode:node toFindings:findings];
+
+      nodesToVisit.pop_back();
+      continue;
+    }
+
+    // Must not be accessed after the stack has grown
+    nodeToVisit.ChildrenWerePushed = true;
+
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> children;
+    for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+      children.push_back(child);
+
+    for (auto it = children.rbegin(); it != children.rend(); ++it)
+      nodesToVisit.push_back({ *it, false, childrenHaveGameInfoAncestor, false });
+  }
+
+  [self pruneIfNecessary];
+
+  self.numberOfValidatedNodes = numberOfValidatedNodes;
+
+  return [SGFCValidationUtility messagesWithFindings:findings
+                                          gameNumber:gameNumber];
+}
+
+#pragma mark - Private API
+
+// Returns the entry for @a node. Creates a new dirty entry if the cache has
+// no entry for @a node, or if the existing entry belongs to a node that no
+// longer exists.
+- (NodeEntry&) nodeEntryForNode:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)node
+{
+  NodeEntry& nodeEntry = _nodeEntries[node.get()];
+
+  if (nodeEntry.Node.lock() != node)
+  {
+    nodeEntry = NodeEntry();
+    nodeEntry.Node = node;
+  }
+
+  return nodeEntry;
+}
+
+// Marks @a node and all of its ancestors as having a dirty subtree. Stops
+// early at the first ancestor that already has a dirty subtree, because the
+// ancestors of that node were marked when it was marked.
+- (void) markSubtreeDirtyStartingAtNode:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)node
+{
+  for (auto ancestor = node; ancestor != nullptr; ancestor = ancestor->GetParent())
+  {
+    auto it = _nodeEntries.find(ancestor.get());
+    if (it == _nodeEntries.end())
+      continue;
+
+    if (it->second.IsSubtreeDirty && ancestor != node)
+      break;
+
+    it->second.IsSubtreeDirty = true;
+  }
+}
+
+// Appends the cached findings of all descendants of @a node to @a findings,
+// in document order. The subtree of @a node must be clean. Subtrees without
+// findings are skipped.
+- (void) appendCachedFindingsOfDescendantsOfNode:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>&)node
+                                      toFindings:(std::vector<SGFCValidationFinding>&)findings
+{
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> nodesToVisit;
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> children;
+  nodesToVisit.push_back(node);
+
+  while (! nodesToVisit.empty())
+  {
+    auto nodeToVisit = std::move(nodesToVisit.back());
+    nodesToVisit.pop_back();
+
+    if (nodeToVisit != node)
+    {
+      const NodeEntry& nodeEntry = _nodeEntries[nodeToVisit.get()];
+      findings.insert(findings.end(), nodeEntry.Findings.begin(), nodeEntry.Findings.end());
+    }
+
+    children.clear();
+    for (auto child = nodeToVisit->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+    {
+      const NodeEntry& childEntry = _nodeEntries[child.get()];
+      if (childEntry.Findings.size() + childEntry.NumberOfDescendantFindings > 0)
+        children.push_back(child);
+    }
+
+    for (auto it = children.rbegin(); it != children.rend(); ++it)
+      nodesToVisit.push_back(*it);
+  }
+}
+
+// Removes the entries of nodes that no longer exist. Pruning is done only
+// when the number of entries has doubled since the last time, so that its
+// cost is amortized over many validation operations.
+- (void) pruneIfNecessary
+{
+  if (_nodeEntries.size() <= _pruneThreshold)
+    return;
+
+  for (auto it = _nodeEntries.begin(); it != _nodeEntries.end(); )
+  {
+    if (it->second.Node.expired())
+      it = _nodeEntries.erase(it);
+    else
+      ++it;
+  }
+
+  _pruneThreshold = std::max(minimumPruneThreshold, 2 * _nodeEntries.size());
+}
+
+@end
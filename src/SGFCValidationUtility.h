@@ -0,0 +1,96 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../include/SGFCMessageID.h"
+#import "../include/SGFCMessageType.h"
+
+// C++ Standard Library includes
+#import <vector>
+
+// System includes
+#import <Foundation/NSObject.h>
+#import <Foundation/NSString.h>
+
+// Forward declarations
+@class NSArray;
+
+namespace LibSgfcPlusPlus
+{
+  class ISgfcGame;
+  class ISgfcNode;
+}
+
+/// @brief The SGFCValidationFinding struct holds the data of a single
+/// problem that SGFCValidationUtility found in a game tree.
+///
+/// @ingroup internals
+/// @ingroup document
+struct SGFCValidationFinding
+{
+  SGFCMessageID MessageID;
+  SGFCMessageType MessageType;
+  NSString* Description;
+};
+
+/// @brief The SGFCValidationUtility class is a container for various
+/// utility functions that validate the libsgfc++ object tree of a game in
+/// memory, without passing it through SGFC.
+///
+/// @ingroup internals
+/// @ingroup document
+///
+/// All functions in SGFCValidationUtility are class methods, so there is no
+/// need to create an instance of SGFCValidationUtility.
+///
+/// The checks are a subset of the checks that SGFC performs when it parses
+/// SGF content. They are limited to the checks that can be performed on
+/// the object tree and that SGFC would perform on the SGF content that
+/// SGFCDocumentWriter generates from the object tree. Each finding uses the
+/// SGFCMessageID of the SGFC message that corresponds to the finding. The
+/// message types are the ones that SGFC uses for the FF4 file format.
+///
+/// The findings for a node depend only on the node itself, on whether the
+/// node is a root node, and on whether one of its ancestors contains game
+/// info properties. This allows clients to cache the findings for a node.
+@interface SGFCValidationUtility : NSObject
+{
+}
+
+/// @brief Validates the game-level data of @a wrappedGame, i.e. the root
+/// node properties that define the game type and the board size, and adds
+/// the findings to @a findings.
++ (void) validateWrappedGame:(const LibSgfcPlusPlus::ISgfcGame&)wrappedGame
+                    findings:(std::vector<SGFCValidationFinding>&)findings;
+
+/// @brief Validates the properties of @a wrappedNode and adds the findings
+/// to @a findings. Returns true if @a wrappedNode contains one or more game
+/// info properties, i.e. if the descendants of @a wrappedNode must be
+/// validated with @a hasGameInfoAncestor set to true.
++ (bool) validateWrappedNode:(const LibSgfcPlusPlus::ISgfcNode&)wrappedNode
+                  isRootNode:(bool)isRootNode
+         hasGameInfoAncestor:(bool)hasGameInfoAncestor
+                    findings:(std::vector<SGFCValidationFinding>&)findings;
+
+/// @brief Returns a collection of newly created SGFCMessage objects, one
+/// for each finding in @a findings, in the same order. The message texts
+/// refer to the game with the 1-based number @a gameNumber.
++ (NSArray*) messagesWithFindings:(const std::vector<SGFCValidationFinding>&)findings
+                       gameNumber:(NSUInteger)gameNumber;
+
+@end
@@ -0,0 +1,306 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../include/SGFCBoardSize.h"
+#import "../include/SGFCConstants.h"
+#import "../include/SGFCGameType.h"
+#import "interface/internal/SGFCMessageInternalAdditions.h"
+#import "SGFCMappingUtility.h"
+#import "SGFCValidationUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcComposedPropertyValue.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+#import <libsgfcplusplus/ISgfcPropertyValue.h>
+#import <libsgfcplusplus/ISgfcSinglePropertyValue.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+#import <string>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // Returns true if the SGF standard allows a property of type
+  // @a propertyType to have no values, i.e. if the property's value type is
+  // "none" or an "elist"
+  bool IsPropertyWithoutValuesAllowed(LibSgfcPlusPlus::SgfcPropertyType propertyType)
+  {
+    switch (propertyType)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyType::KO:
+      case LibSgfcPlusPlus::SgfcPropertyType::IT:
+      case LibSgfcPlusPlus::SgfcPropertyType::DO:
+      case LibSgfcPlusPlus::SgfcPropertyType::FG:
+      case LibSgfcPlusPlus::SgfcPropertyType::VW:
+      case LibSgfcPlusPlus::SgfcPropertyType::DD:
+      case LibSgfcPlusPlus::SgfcPropertyType::TB:
+      case LibSgfcPlusPlus::SgfcPropertyType::TW:
+      // The value type of custom properties is not known
+      case LibSgfcPlusPlus::SgfcPropertyType::Unknown:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Returns true if the SGF standard allows a property of type
+  // @a propertyType in category @a propertyCategory to have only a single
+  // value. Only the properties that SGFC most commonly encounters are
+  // covered, the remaining properties are treated as if they were allowed to
+  // have a list of values.
+  bool IsSingleValueProperty(LibSgfcPlusPlus::SgfcPropertyType propertyType,
+                             LibSgfcPlusPlus::SgfcPropertyCategory propertyCategory)
+  {
+    switch (propertyCategory)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyCategory::Root:
+      case LibSgfcPlusPlus::SgfcPropertyCategory::GameInfo:
+        return true;
+      default:
+        break;
+    }
+
+    switch (propertyType)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyType::B:
+      case LibSgfcPlusPlus::SgfcPropertyType::W:
+      case LibSgfcPlusPlus::SgfcPropertyType::MN:
+      case LibSgfcPlusPlus::SgfcPropertyType::PL:
+      case LibSgfcPlusPlus::SgfcPropertyType::C:
+      case LibSgfcPlusPlus::SgfcPropertyType::N:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  // Returns true if @a propertyValue, or one of its parts if it is a
+  // composed value, has a raw value that libsgfc++ was unable to convert to
+  // the value type that the SGF standard defines for the property.
+  bool HasIllegalValue(const LibSgfcPlusPlus::ISgfcPropertyValue& propertyValue)
+  {
+    if (propertyValue.IsComposedValue())
+    {
+      const LibSgfcPlusPlus::ISgfcComposedPropertyValue* composedValue = propertyValue.ToComposedValue();
+      return (! composedValue->GetValue1()->HasTypedValue() ||
+              ! composedValue->GetValue2()->HasTypedValue());
+    }
+    else
+    {
+      return ! propertyValue.ToSingleValue()->HasTypedValue();
+    }
+  }
+
+  void AddFinding(std::vector<SGFCValidationFinding>& findings,
+                  SGFCMessageID messageID,
+                  SGFCMessageType messageType,
+                  NSString* description)
+  {
+    findings.push_back({ messageID, messageType, description });
+  }
+}
+
+@implementation SGFCValidationUtility
+
+#pragma mark - Public API
+
++ (void) validateWrappedGame:(const LibSgfcPlusPlus::ISgfcGame&)wrappedGame
+                    findings:(std::vector<SGFCValidationFinding>&)findings
+{
+  SGFCGameType gameType = [SGFCMappingUtility toSgfcKitGameType:wrappedGame.GetGameType()];
+  if (gameType == SGFCGameTypeUnknown)
+  {
+    AddFinding(findings, SGFCMessageIDIllegalRootPropertyValue, SGFCMessageTypeError,
+               @"illegal value for root property GM");
+  }
+  else if (gameType != SGFCGameTypeGo)
+  {
+    AddFinding(findings, SGFCMessageIDGameIsNotGo, SGFCMessageTypeWarning,
+               @"game is not Go, move and position values are not checked");
+  }
+
+  SGFCBoardSize boardSize = [SGFCMappingUtility toSgfcKitBoardSize:wrappedGame.GetBoardSize()];
+  if (SGFCBoardSizeEqualToBoardSize(boardSize, SGFCBoardSizeInvalid))
+  {
+    AddFinding(findings, SGFCMessageIDIllegalRootPropertyValue, SGFCMessageTypeError,
+               @"illegal value for root property SZ");
+  }
+}
+
++ (bool) validateWrappedNode:(const LibSgfcPlusPlus::ISgfcNode&)wrappedNode
+                  isRootNode:(bool)isRootNode
+         hasGameInfoAncestor:(bool)hasGameInfoAncestor
+                    findings:(std::vector<SGFCValidationFinding>&)findings
+{
+  bool hasBlackMove = false;
+  bool hasWhiteMove = false;
+  bool hasSetup = false;
+  bool hasMoveAnnotation = false;
+  bool hasGameInfo = false;
+
+  // Nodes usually have only a handful of properties, so a linear search for
+  // duplicates is cheaper than a set
+  std::vector<std::string> propertyNames;
+
+  for (const auto& wrappedProperty : wrappedNode.GetProperties())
+  {
+    const std::string& propertyName = wrappedProperty->GetPropertyName();
+    NSString* mappedPropertyName = nil;
+    auto mappedPropertyNameIfNeeded = [&]()
+    {
+      if (! mappedPropertyName)
+        mappedPropertyName = [SGFCMappingUtility toSgfcKitString:propertyName];
+      return mappedPropertyName;
+    };
+
+    if (std::find(propertyNames.begin(), propertyNames.end(), propertyName) != propertyNames.end())
+    {
+      AddFinding(findings, SGFCMessageIDDuplicatePropertyDeleted, SGFCMessageTypeError,
+                 [NSString stringWithFormat:@"property %@ already exists in the node", mappedPropertyNameIfNeeded()]);
+    }
+    else
+    {
+      propertyNames.push_back(propertyName);
+    }
+
+    if (std::any_of(propertyName.begin(), propertyName.end(), [](char c) { return c >= 'a' && c <= 'z'; }))
+    {
+      AddFinding(findings, SGFCMessageIDPropertyIdentifierWithLowercaseCharacter, SGFCMessageTypeWarning,
+                 [NSString stringWithFormat:@"property identifier %@ contains lowercase characters", mappedPropertyNameIfNeeded()]);
+    }
+
+    auto propertyType = wrappedProperty->GetPropertyType();
+    auto propertyCategory = wrappedProperty->GetPropertyCategory();
+    const auto& propertyValues = wrappedProperty->GetPropertyValues();
+
+    if (propertyValues.empty())
+    {
+      if (! IsPropertyWithoutValuesAllowed(propertyType))
+      {
+        AddFinding(findings, SGFCMessageIDPropertyWithoutValuesIgnored, SGFCMessageTypeWarning,
+                   [NSString stringWithFormat:@"property %@ has no values", mappedPropertyNameIfNeeded()]);
+      }
+    }
+    else if (propertyValues.size() > 1 && IsSingleValueProperty(propertyType, propertyCategory))
+    {
+      AddFinding(findings, SGFCMessageIDSurplusValuesDeleted, SGFCMessageTypeError,
+                 [NSString stringWithFormat:@"property %@ has more than one value", mappedPropertyNameIfNeeded()]);
+    }
+
+    // The value type of custom properties is not known, so libsgfc++ never
+    // converts their raw values
+    if (propertyType != LibSgfcPlusPlus::SgfcPropertyType::Unknown)
+    {
+      for (const auto& propertyValue : propertyValues)
+      {
+        if (HasIllegalValue(*propertyValue))
+        {
+          AddFinding(findings, SGFCMessageIDIllegalValueDeleted, SGFCMessageTypeError,
+                     [NSString stringWithFormat:@"illegal value for property %@", mappedPropertyNameIfNeeded()]);
+        }
+      }
+    }
+
+    switch (propertyCategory)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyCategory::Root:
+        if (! isRootNode)
+        {
+          AddFinding(findings, SGFCMessageIDRootPropertyDeleted, SGFCMessageTypeError,
+                     [NSString stringWithFormat:@"root property %@ outside of the root node", mappedPropertyNameIfNeeded()]);
+        }
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyCategory::GameInfo:
+        hasGameInfo = true;
+        if (hasGameInfoAncestor)
+        {
+          AddFinding(findings, SGFCMessageIDGameInfoDeleted, SGFCMessageTypeError,
+                     [NSString stringWithFormat:@"game info property %@ in a node below another game info node", mappedPropertyNameIfNeeded()]);
+        }
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyCategory::Move:
+        if (propertyType == LibSgfcPlusPlus::SgfcPropertyType::B)
+          hasBlackMove = true;
+        else if (propertyType == LibSgfcPlusPlus::SgfcPropertyType::W)
+          hasWhiteMove = true;
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyCategory::Setup:
+        hasSetup = true;
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyCategory::MoveAnnotation:
+        hasMoveAnnotation = true;
+        break;
+      default:
+        break;
+    }
+  }
+
+  bool hasMove = hasBlackMove || hasWhiteMove;
+
+  if (hasMove && isRootNode)
+  {
+    AddFinding(findings, SGFCMessageIDMoveInRootNodeSplit, SGFCMessageTypeWarning,
+               @"move in the root node");
+  }
+
+  if (hasMove && hasSetup)
+  {
+    AddFinding(findings, SGFCMessageIDMixedSetupAndMove, SGFCMessageTypeError,
+               @"setup and move properties mixed within a node");
+  }
+
+  if (hasBlackMove && hasWhiteMove)
+  {
+    AddFinding(findings, SGFCMessageIDBlackAndWhiteMoveSplit, SGFCMessageTypeError,
+               @"black and white move within a node");
+  }
+
+  if (hasMoveAnnotation && ! hasMove)
+  {
+    AddFinding(findings, SGFCMessageIDMoveAnnotationDeleted, SGFCMessageTypeWarning,
+               @"move annotation in a node without a move");
+  }
+
+  return hasGameInfo;
+}
+
++ (NSArray*) messagesWithFindings:(const std::vector<SGFCValidationFinding>&)findings
+                       gameNumber:(NSUInteger)gameNumber
+{
+  NSMutableArray* messages = [NSMutableArray arrayWithCapacity:findings.size()];
+
+  for (const auto& finding : findings)
+  {
+    NSString* messageText = [NSString stringWithFormat:@"game %lu: %@",
+                             static_cast<unsigned long>(gameNumber), finding.Description];
+    SGFCMessage* message = [[SGFCMessage alloc] initWithMessageID:finding.MessageID
+                                                      messageType:finding.MessageType
+                                                      messageText:messageText];
+    [messages addObject:message];
+  }
+
+  return messages;
+}
+
+@end
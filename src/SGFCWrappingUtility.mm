@@ -34,6 +34,7 @@
 #import "interface/internal/SGFCGoPointPropertyValueInternalAdditions.h"
 #import "interface/internal/SGFCGoStoneInternalAdditions.h"
 #import "interface/internal/SGFCGoStonePropertyValueInternalAdditions.h"
+#import "interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "interface/internal/SGFCMessageInternalAdditions.h"
 #import "interface/internal/SGFCNodeInternalAdditions.h"
 #import "interface/internal/SGFCMovePropertyValueInternalAdditions.h"
@@ -52,12 +53,37 @@
 #import <Foundation/NSArray.h>
 #import <Foundation/NSString.h>
 
+#pragma mark - Helper functions
+
+namespace
+{
+  // Returns a shared_ptr that points to @a typedObject and that shares
+  // ownership with @a owner.
+  //
+  // The libsgfc++ interfaces provide To...() methods that return a raw
+  // pointer to the same object, but typed as a more specific interface.
+  // Packaging that raw pointer into a shared_ptr with the aliasing
+  // constructor performs the downcast without the RTTI lookup that
+  // std::dynamic_pointer_cast requires. std::static_pointer_cast cannot be
+  // used because of multiple inheritance. The To...() methods return
+  // pointers to const, but the underlying objects are not const.
+  template<typename TypedInterface, typename OwnerInterface>
+  std::shared_ptr<TypedInterface> AliasedPointer(
+    const std::shared_ptr<OwnerInterface>& owner,
+    const TypedInterface* typedObject)
+  {
+    return std::shared_ptr<TypedInterface>(owner, const_cast<TypedInterface*>(typedObject));
+  }
+}
+
 @implementation SGFCWrappingUtility
 
 #pragma mark - Public API
 
 + (SGFCArgument*) wrapArgument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcArgument>)argumentToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::OtherWrapperCount);
+
   return [[SGFCArgument alloc] initWithWrappedArgument:argumentToWrap];
 }
 
@@ -76,26 +102,37 @@
 
 + (SGFCArguments*) wrapArguments:(std::shared_ptr<LibSgfcPlusPlus::ISgfcArguments>)argumentsToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::OtherWrapperCount);
+
   return [[SGFCArguments alloc] initWithWrappedArguments:argumentsToWrap];
 }
 
 + (SGFCDocument*) wrapDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)documentToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::DocumentWrapperCount);
+
   return [[SGFCDocument alloc] initWithWrappedDocument:documentToWrap];
 }
 
 + (SGFCDocumentReadResult*) wrapDocumentReadResult:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>)documentReadResultToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::OtherWrapperCount);
+
   return [[SGFCDocumentReadResult alloc] initWithWrappedDocumentReadResult:documentReadResultToWrap];
 }
 
 + (SGFCDocumentWriteResult*) wrapDocumentWriteResult:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentWriteResult>)documentWriteResultToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::OtherWrapperCount);
+
   return [[SGFCDocumentWriteResult alloc] initWithWrappedDocumentWriteResult:documentWriteResultToWrap];
 }
 
 + (NSArray*) wrapGames:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>>&)gamesToWrap
 {
+  SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WrapDuration);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::GameWrapperCount, gamesToWrap.size());
+
   NSMutableArray* games = [NSMutableArray arrayWithCapacity:0];
 
   for (auto gameToWrap : gamesToWrap)
@@ -108,26 +145,36 @@
 
 + (SGFCGoMove*) wrapGoMove:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGoMove>)goMoveToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::GoObjectWrapperCount);
+
   return [[SGFCGoMove alloc] initWithWrappedGoMove:goMoveToWrap];
 }
 
 + (SGFCGoPoint*) wrapGoPoint:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGoPoint>)goPointToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::GoObjectWrapperCount);
+
   return [[SGFCGoPoint alloc] initWithWrappedGoPoint:goPointToWrap];
 }
 
 + (SGFCGoStone*) wrapGoStone:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGoStone>)goStoneToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::GoObjectWrapperCount);
+
   return [[SGFCGoStone alloc] initWithWrappedGoStone:goStoneToWrap];
 }
 
 + (SGFCMessage*) wrapMessage:(std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>)messageToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::MessageWrapperCount);
+
   return [[SGFCMessage alloc] initWithWrappedMessage:messageToWrap];
 }
 
 + (NSArray*) wrapMessages:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messagesToWrap
 {
+  SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WrapDuration);
+
   NSMutableArray* messages = [NSMutableArray arrayWithCapacity:0];
 
   for (auto messageToWrap : messagesToWrap)
@@ -141,11 +188,16 @@
 
 + (SGFCNode*) wrapNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)nodeToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::NodeWrapperCount);
+
   return [[SGFCNode alloc] initWithWrappedNode:nodeToWrap];
 }
 
 + (NSArray*) wrapNodes:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>>&)nodesToWrap
 {
+  SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WrapDuration);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::NodeWrapperCount, nodesToWrap.size());
+
   NSMutableArray* nodes = [NSMutableArray arrayWithCapacity:0];
 
   for (auto nodeToWrap : nodesToWrap)
@@ -158,25 +210,26 @@
 
 + (SGFCProperty*) wrapProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)propertyToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::PropertyWrapperCount);
+
   SGFCProperty* property;
 
-  // std::dynamic_pointer_cast performs a downcast and packages the
-  // result into a shared_ptr, all in one go. Note: We can't use
-  // std::static_pointer_cast because of multiple inheritance.
+  // AliasedPointer() performs a downcast and packages the result into a
+  // shared_ptr, all in one go, without an RTTI lookup.
 
   switch (propertyToWrap->GetPropertyType())
   {
     case LibSgfcPlusPlus::SgfcPropertyType::GM:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcGameTypeProperty> gameTypePropertyToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcGameTypeProperty>(propertyToWrap);
+        AliasedPointer(propertyToWrap, propertyToWrap->ToGameTypeProperty());
       property = [[SGFCGameTypeProperty alloc] initWithWrappedGameTypeProperty:gameTypePropertyToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyType::SZ:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcBoardSizeProperty> boardSizePropertyToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcBoardSizeProperty>(propertyToWrap);
+        AliasedPointer(propertyToWrap, propertyToWrap->ToBoardSizeProperty());
       property = [[SGFCBoardSizeProperty alloc] initWithWrappedBoardSizeProperty:boardSizePropertyToWrap];
       break;
     }
@@ -192,11 +245,15 @@
 
 + (NSArray*) wrapProperties:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>>&)propertiesToWrap
 {
-  NSMutableArray* properties = [NSMutableArray arrayWithCapacity:0];
+  SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WrapDuration);
+
+  NSMutableArray* properties = [NSMutableArray arrayWithCapacity:propertiesToWrap.size()];
 
-  for (auto propertyToWrap : propertiesToWrap)
+  // Use wrapProperty:() so that the collection contains the same typed
+  // subclasses as the result of e.g. SGFCNode::propertyWithType:()
+  for (const auto& propertyToWrap : propertiesToWrap)
   {
-    [properties addObject:[[SGFCProperty alloc] initWithWrappedProperty:propertyToWrap]];
+    [properties addObject:[SGFCWrappingUtility wrapProperty:propertyToWrap]];
   }
 
   return properties;
@@ -206,21 +263,21 @@
 {
   id<SGFCPropertyValue> propertyValue = nil;
 
-  // std::dynamic_pointer_cast performs a downcast and packages the
-  // result into a shared_ptr, all in one go. Note: We can't use
-  // std::static_pointer_cast because of multiple inheritance.
+  // AliasedPointer() performs a downcast and packages the result into a
+  // shared_ptr, all in one go, without an RTTI lookup.
 
   if (propertyValueToWrap->IsComposedValue())
   {
     std::shared_ptr<LibSgfcPlusPlus::ISgfcComposedPropertyValue> composedPropertyValueToWrap =
-      std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcComposedPropertyValue>(propertyValueToWrap);
+      AliasedPointer(propertyValueToWrap, propertyValueToWrap->ToComposedValue());
 
     propertyValue = [[SGFCComposedPropertyValue alloc] initWithWrappedComposedPropertyValue:composedPropertyValueToWrap];
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::PropertyValueWrapperCount);
   }
   else
   {
     std::shared_ptr<LibSgfcPlusPlus::ISgfcSinglePropertyValue> singlePropertyValueToWrap =
-      std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcSinglePropertyValue>(propertyValueToWrap);
+      AliasedPointer(propertyValueToWrap, propertyValueToWrap->ToSingleValue());
 
     propertyValue = [SGFCWrappingUtility wrapSinglePropertyValue:singlePropertyValueToWrap];
   }
@@ -230,63 +287,71 @@
 
 + (SGFCSinglePropertyValue*) wrapSinglePropertyValue:(std::shared_ptr<LibSgfcPlusPlus::ISgfcSinglePropertyValue>)singlePropertyValueToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::PropertyValueWrapperCount);
+
   SGFCSinglePropertyValue* singlePropertyValue = nil;
 
-  // std::dynamic_pointer_cast performs a downcast and packages the
-  // result into a shared_ptr, all in one go. Note: We can't use
-  // std::static_pointer_cast because of multiple inheritance.
+  // AliasedPointer() performs a downcast and packages the result into a
+  // shared_ptr, all in one go, without an RTTI lookup. The value type
+  // already tells us which To...() method to use. For Point, Move and Stone
+  // values the result of ToGo...Value() is used both to find out whether the
+  // value is a Go value and to perform the downcast.
 
   switch (singlePropertyValueToWrap->GetValueType())
   {
     case LibSgfcPlusPlus::SgfcPropertyValueType::Color:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcColorPropertyValue> colorPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcColorPropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToColorValue());
       singlePropertyValue = [[SGFCColorPropertyValue alloc] initWithWrappedColorPropertyValue:colorPropertyValueToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::Double:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcDoublePropertyValue> doublePropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcDoublePropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToDoubleValue());
       singlePropertyValue = [[SGFCDoublePropertyValue alloc] initWithWrappedDoublePropertyValue:doublePropertyValueToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::Number:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcNumberPropertyValue> numberPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcNumberPropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToNumberValue());
       singlePropertyValue = [[SGFCNumberPropertyValue alloc] initWithWrappedNumberPropertyValue:numberPropertyValueToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::Point:
     {
-      std::shared_ptr<LibSgfcPlusPlus::ISgfcPointPropertyValue> pointPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcPointPropertyValue>(singlePropertyValueToWrap);
-      if (pointPropertyValueToWrap->ToGoPointValue())
+      const LibSgfcPlusPlus::ISgfcPointPropertyValue* pointPropertyValue = singlePropertyValueToWrap->ToPointValue();
+      const LibSgfcPlusPlus::ISgfcGoPointPropertyValue* goPointPropertyValue = pointPropertyValue->ToGoPointValue();
+      if (goPointPropertyValue)
       {
         std::shared_ptr<LibSgfcPlusPlus::ISgfcGoPointPropertyValue> goPointPropertyValueToWrap =
-          std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcGoPointPropertyValue>(singlePropertyValueToWrap);
+          AliasedPointer(singlePropertyValueToWrap, goPointPropertyValue);
         singlePropertyValue = [[SGFCGoPointPropertyValue alloc] initWithWrappedGoPointPropertyValue:goPointPropertyValueToWrap];
       }
       else
       {
+        std::shared_ptr<LibSgfcPlusPlus::ISgfcPointPropertyValue> pointPropertyValueToWrap =
+          AliasedPointer(singlePropertyValueToWrap, pointPropertyValue);
         singlePropertyValue = [[SGFCPointPropertyValue alloc] initWithWrappedPointPropertyValue:pointPropertyValueToWrap];
       }
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::Move:
     {
-      std::shared_ptr<LibSgfcPlusPlus::ISgfcMovePropertyValue> movePropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcMovePropertyValue>(singlePropertyValueToWrap);
-      if (movePropertyValueToWrap->ToGoMoveValue())
+      const LibSgfcPlusPlus::ISgfcMovePropertyValue* movePropertyValue = singlePropertyValueToWrap->ToMoveValue();
+      const LibSgfcPlusPlus::ISgfcGoMovePropertyValue* goMovePropertyValue = movePropertyValue->ToGoMoveValue();
+      if (goMovePropertyValue)
       {
         std::shared_ptr<LibSgfcPlusPlus::ISgfcGoMovePropertyValue> goMovePropertyValueToWrap =
-          std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcGoMovePropertyValue>(singlePropertyValueToWrap);
+          AliasedPointer(singlePropertyValueToWrap, goMovePropertyValue);
         singlePropertyValue = [[SGFCGoMovePropertyValue alloc] initWithWrappedGoMovePropertyValue:goMovePropertyValueToWrap];
       }
       else
       {
+        std::shared_ptr<LibSgfcPlusPlus::ISgfcMovePropertyValue> movePropertyValueToWrap =
+          AliasedPointer(singlePropertyValueToWrap, movePropertyValue);
         singlePropertyValue = [[SGFCMovePropertyValue alloc] initWithWrappedMovePropertyValue:movePropertyValueToWrap];
       }
       break;
@@ -294,29 +359,31 @@
     case LibSgfcPlusPlus::SgfcPropertyValueType::Real:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcRealPropertyValue> realPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcRealPropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToRealValue());
       singlePropertyValue = [[SGFCRealPropertyValue alloc] initWithWrappedRealPropertyValue:realPropertyValueToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::SimpleText:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcSimpleTextPropertyValue> simpleTextPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcSimpleTextPropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToSimpleTextValue());
       singlePropertyValue = [[SGFCSimpleTextPropertyValue alloc] initWithWrappedSimpleTextPropertyValue:simpleTextPropertyValueToWrap];
       break;
     }
     case LibSgfcPlusPlus::SgfcPropertyValueType::Stone:
     {
-      std::shared_ptr<LibSgfcPlusPlus::ISgfcStonePropertyValue> stonePropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcStonePropertyValue>(singlePropertyValueToWrap);
-      if (stonePropertyValueToWrap->ToGoStoneValue())
+      const LibSgfcPlusPlus::ISgfcStonePropertyValue* stonePropertyValue = singlePropertyValueToWrap->ToStoneValue();
+      const LibSgfcPlusPlus::ISgfcGoStonePropertyValue* goStonePropertyValue = stonePropertyValue->ToGoStoneValue();
+      if (goStonePropertyValue)
       {
         std::shared_ptr<LibSgfcPlusPlus::ISgfcGoStonePropertyValue> goStonePropertyValueToWrap =
-          std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcGoStonePropertyValue>(singlePropertyValueToWrap);
+          AliasedPointer(singlePropertyValueToWrap, goStonePropertyValue);
         singlePropertyValue = [[SGFCGoStonePropertyValue alloc] initWithWrappedGoStonePropertyValue:goStonePropertyValueToWrap];
       }
       else
       {
+        std::shared_ptr<LibSgfcPlusPlus::ISgfcStonePropertyValue> stonePropertyValueToWrap =
+          AliasedPointer(singlePropertyValueToWrap, stonePropertyValue);
         singlePropertyValue = [[SGFCStonePropertyValue alloc] initWithWrappedStonePropertyValue:stonePropertyValueToWrap];
       }
       break;
@@ -324,7 +391,7 @@
     case LibSgfcPlusPlus::SgfcPropertyValueType::Text:
     {
       std::shared_ptr<LibSgfcPlusPlus::ISgfcTextPropertyValue> textPropertyValueToWrap =
-        std::dynamic_pointer_cast<LibSgfcPlusPlus::ISgfcTextPropertyValue>(singlePropertyValueToWrap);
+        AliasedPointer(singlePropertyValueToWrap, singlePropertyValueToWrap->ToTextValue());
       singlePropertyValue = [[SGFCTextPropertyValue alloc] initWithWrappedTextPropertyValue:textPropertyValueToWrap];
       break;
     }
@@ -352,9 +419,11 @@
 
 + (NSArray*) wrapPropertyValues:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>&)propertyValuesToWrap
 {
-  NSMutableArray* propertyValues = [NSMutableArray arrayWithCapacity:0];
+  SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WrapDuration);
+
+  NSMutableArray* propertyValues = [NSMutableArray arrayWithCapacity:propertyValuesToWrap.size()];
 
-  for (auto propertyValueToWrap : propertyValuesToWrap)
+  for (const auto& propertyValueToWrap : propertyValuesToWrap)
   {
     id<SGFCPropertyValue> propertyValue = [SGFCWrappingUtility wrapPropertyValue:propertyValueToWrap];
     [propertyValues addObject:propertyValue];
@@ -365,6 +434,8 @@
 
 + (SGFCGameInfo*) wrapGameInfo:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGameInfo>)gameInfoToWrap
 {
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::OtherWrapperCount);
+
   if (gameInfoToWrap->ToGoGameInfo() == nullptr)
   {
     return [[SGFCGameInfo alloc] initWithWrappedGameInfo:gameInfoToWrap];
@@ -16,7 +16,10 @@ set (
   document/typedpropertyvalue/SGFCTextPropertyValue.mm
   document/SGFCComposedPropertyValue.mm
   document/SGFCDocument.mm
+  document/SGFCDocumentSnapshot.mm
+  document/SGFCDocumentValidator.mm
   document/SGFCGame.mm
+  document/SGFCGameHistory.mm
   document/SGFCNode.mm
   document/SGFCProperty.mm
   document/SGFCSinglePropertyValue.mm
@@ -30,6 +33,7 @@ set (
   game/go/SGFCGoPoint.mm
   game/go/SGFCGoRuleset.mm
   game/go/SGFCGoStone.mm
+  game/go/SGFCPackedGoMove.mm
   game/NSValue+SGFCDate.mm
   game/SGFCBoardSize.mm
   game/SGFCDate.mm
@@ -38,16 +42,28 @@ set (
   game/SGFCRoundInformation.mm
   sgfc/argument/SGFCArgument.mm
   sgfc/argument/SGFCArguments.mm
+  sgfc/argument/SGFCCompiledArguments.mm
   sgfc/frontend/SGFCCommandLine.mm
   sgfc/frontend/SGFCDocumentReader.mm
+  sgfc/frontend/SGFCDocumentReaderPool.mm
   sgfc/frontend/SGFCDocumentReadResult.mm
+  sgfc/frontend/SGFCDocumentReadStatistics.mm
   sgfc/frontend/SGFCDocumentWriter.mm
+  sgfc/frontend/SGFCDocumentWriterPool.mm
   sgfc/frontend/SGFCDocumentWriteResult.mm
   sgfc/message/SGFCMessage.mm
+  SGFCBackgroundReclaimer.mm
+  SGFCCloningUtility.mm
   SGFCConstants.mm
   SGFCExceptionUtility.mm
+  SGFCKitMetrics.mm
   SGFCMappingUtility.mm
+  SGFCMessageUtility.mm
+  SGFCObjectPool.mm
   SGFCPrivateConstants.mm
+  SGFCTrustedInputParser.mm
+  SGFCValidationCache.mm
+  SGFCValidationUtility.mm
   SGFCWrappingUtility.mm
   ${SOURCES_LIST_FILE_NAME}
 )
@@ -58,11 +74,14 @@ set (
   interface/internal/SGFCArgumentsInternalAdditions.h
   interface/internal/SGFCBoardSizePropertyInternalAdditions.h
   interface/internal/SGFCColorPropertyValueInternalAdditions.h
+  interface/internal/SGFCCompiledArgumentsInternalAdditions.h
   interface/internal/SGFCComposedPropertyValueInternalAdditions.h
   interface/internal/SGFCDocumentInternalAdditions.h
   interface/internal/SGFCDocumentReadResultInternalAdditions.h
+  interface/internal/SGFCDocumentReadStatisticsInternalAdditions.h
   interface/internal/SGFCDocumentWriteResultInternalAdditions.h
   interface/internal/SGFCDoublePropertyValueInternalAdditions.h
+  interface/internal/SGFCGameHistoryInternalAdditions.h
   interface/internal/SGFCGameInfoInternalAdditions.h
   interface/internal/SGFCGameInternalAdditions.h
   interface/internal/SGFCGameTypePropertyInternalAdditions.h
@@ -73,6 +92,7 @@ set (
   interface/internal/SGFCGoPointPropertyValueInternalAdditions.h
   interface/internal/SGFCGoStoneInternalAdditions.h
   interface/internal/SGFCGoStonePropertyValueInternalAdditions.h
+  interface/internal/SGFCKitMetricsInternalAdditions.h
   interface/internal/SGFCMessageInternalAdditions.h
   interface/internal/SGFCMovePropertyValueInternalAdditions.h
   interface/internal/SGFCNodeInternalAdditions.h
@@ -86,9 +106,16 @@ set (
   interface/internal/SGFCStonePropertyValueInternalAdditions.h
   interface/internal/SGFCTextPropertyValueInternalAdditions.h
   interface/internal/SGFCTreeBuilderInternalAdditions.h
+  SGFCBackgroundReclaimer.h
+  SGFCCloningUtility.h
   SGFCExceptionUtility.h
   SGFCMappingUtility.h
+  SGFCMessageUtility.h
+  SGFCObjectPool.h
   SGFCPrivateConstants.h
+  SGFCTrustedInputParser.h
+  SGFCValidationCache.h
+  SGFCValidationUtility.h
   SGFCWrappingUtility.h
 )
 
@@ -108,19 +135,26 @@ set (
   ../include/SGFCColor.h
   ../include/SGFCColorPropertyValue.h
   ../include/SGFCCommandLine.h
+  ../include/SGFCCompiledArguments.h
   ../include/SGFCComposedPropertyValue.h
   ../include/SGFCConstants.h
   ../include/SGFCCoordinateSystem.h
   ../include/SGFCDate.h
   ../include/SGFCDocument.h
   ../include/SGFCDocumentReader.h
+  ../include/SGFCDocumentReaderPool.h
+  ../include/SGFCDocumentSnapshot.h
+  ../include/SGFCDocumentValidator.h
   ../include/SGFCDocumentReadResult.h
+  ../include/SGFCDocumentReadStatistics.h
   ../include/SGFCDocumentWriter.h
+  ../include/SGFCDocumentWriterPool.h
   ../include/SGFCDocumentWriteResult.h
   ../include/SGFCDouble.h
   ../include/SGFCDoublePropertyValue.h
   ../include/SGFCExitCode.h
   ../include/SGFCGame.h
+  ../include/SGFCGameHistory.h
   ../include/SGFCGameInfo.h
   ../include/SGFCGameResult.h
   ../include/SGFCGameResultType.h
@@ -141,12 +175,14 @@ set (
   ../include/SGFCGoStonePropertyValue.h
   ../include/SGFCMovePropertyValue.h
   ../include/SGFCKitFactory.h
+  ../include/SGFCKitMetrics.h
   ../include/SGFCMessage.h
   ../include/SGFCMessageID.h
   ../include/SGFCMessageType.h
   ../include/SGFCNode.h
   ../include/SGFCNodeTraits.h
   ../include/SGFCNumberPropertyValue.h
+  ../include/SGFCPackedGoMove.h
   ../include/SGFCPointPropertyValue.h
   ../include/SGFCProperty.h
   ../include/SGFCPropertyCategory.h
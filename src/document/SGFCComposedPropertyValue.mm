@@ -18,6 +18,7 @@
 #import "../../include/SGFCComposedPropertyValue.h"
 #import "../../include/SGFCSinglePropertyValue.h"
 #import "../interface/internal/SGFCComposedPropertyValueInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCWrappingUtility.h"
@@ -72,6 +73,7 @@
   _wrappedComposedPropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateCustomComposedPropertyValue(
     [value1 wrappedSinglePropertyValue],
     [value2 wrappedSinglePropertyValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   self.composedValue = YES;
   self.value1 = value1;
   self.value1 = value2;
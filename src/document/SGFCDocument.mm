@@ -18,6 +18,9 @@
 #import "../../include/SGFCDocument.h"
 #import "../interface/internal/SGFCDocumentInternalAdditions.h"
 #import "../interface/internal/SGFCGameInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
+#import "../SGFCBackgroundReclaimer.h"
+#import "../SGFCCloningUtility.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
 #import "../SGFCWrappingUtility.h"
@@ -67,11 +70,13 @@
   if (game == nil)
   {
     _wrappedDocument = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument();
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
     self.games = [NSMutableArray arrayWithCapacity:0];
   }
   else
   {
     _wrappedDocument = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument([game wrappedGame]);
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
     self.games = [NSMutableArray arrayWithObject:game];
   }
 
@@ -95,11 +100,25 @@
 
 - (void) dealloc
 {
+  if (_reclaimsMemoryInBackground)
+  {
+    [SGFCBackgroundReclaimer reclaimWrappedDocument:std::move(_wrappedDocument)
+                                     wrapperObjects:&_games];
+  }
+
   _wrappedDocument = nullptr;
   // Don't use property accessor because of nil check
   _games = nil;
 }
 
+#pragma mark - NSCopying overrides
+
+- (id) copyWithZone:(NSZone*)zone
+{
+  auto clonedDocument = [SGFCCloningUtility cloneDocument:_wrappedDocument];
+  return [[[self class] allocWithZone:zone] initWithWrappedDocument:clonedDocument];
+}
+
 #pragma mark - Public API
 
 - (BOOL) isEmpty
@@ -109,6 +128,8 @@
 
 - (void) setGames:(NSArray*)games
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"document"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:games
                                                  invalidArgumentName:@"games"];
 
@@ -144,6 +165,8 @@
 
 - (void) appendGame:(SGFCGame*)game
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"document"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:game
                                                  invalidArgumentName:@"game"];
 
@@ -161,6 +184,8 @@
 
 - (void) removeGame:(SGFCGame*)game
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"document"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:game
                                                  invalidArgumentName:@"game"];
 
@@ -178,10 +203,24 @@
 
 - (void) removeAllGames
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"document"];
+
   _wrappedDocument->RemoveAllGames();
   [(NSMutableArray*)_games removeAllObjects];
 }
 
+- (void) freeze
+{
+  if (_frozen)
+    return;
+
+  for (SGFCGame* game in _games)
+    [game freeze];
+
+  _frozen = YES;
+}
+
 - (void) debugPrintToConsole
 {
   _wrappedDocument->DebugPrintToConsole();
@@ -0,0 +1,836 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../include/SGFCDocumentSnapshot.h"
+#import "../interface/internal/SGFCGameInternalAdditions.h"
+#import "../interface/internal/SGFCDocumentInternalAdditions.h"
+#import "../SGFCExceptionUtility.h"
+#import "../SGFCWrappingUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcColorPropertyValue.h>
+#import <libsgfcplusplus/ISgfcComposedPropertyValue.h>
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcDoublePropertyValue.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcGoMove.h>
+#import <libsgfcplusplus/ISgfcGoMovePropertyValue.h>
+#import <libsgfcplusplus/ISgfcGoStone.h>
+#import <libsgfcplusplus/ISgfcGoStonePropertyValue.h>
+#import <libsgfcplusplus/ISgfcMovePropertyValue.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcNumberPropertyValue.h>
+#import <libsgfcplusplus/ISgfcPointPropertyValue.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+#import <libsgfcplusplus/ISgfcPropertyFactory.h>
+#import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
+#import <libsgfcplusplus/ISgfcRealPropertyValue.h>
+#import <libsgfcplusplus/ISgfcSimpleTextPropertyValue.h>
+#import <libsgfcplusplus/ISgfcSinglePropertyValue.h>
+#import <libsgfcplusplus/ISgfcStonePropertyValue.h>
+#import <libsgfcplusplus/ISgfcTextPropertyValue.h>
+#import <libsgfcplusplus/ISgfcTreeBuilder.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+#import <Foundation/NSData.h>
+#import <Foundation/NSString.h>
+
+// C++ Standard Library includes
+#import <cstring>
+#import <stack>
+#import <string>
+#import <unordered_map>
+#import <vector>
+
+#pragma mark - Snapshot format
+
+// The layout of the snapshot format is documented in SGFCDocumentSnapshot.h.
+// All offsets and record sizes are in bytes.
+namespace
+{
+  const char snapshotMagic[] = { 'S', 'G', 'F', 'C', 'S', 'N', 'A', 'P' };
+  const uint32_t snapshotFormatVersion = 1;
+
+  const size_t headerSize = 64;
+  const size_t headerOffsetFormatVersion = 8;
+  const size_t headerOffsetNumberOfGames = 12;
+  const size_t headerOffsetNumberOfNodes = 16;
+  const size_t headerOffsetNumberOfProperties = 20;
+  const size_t headerOffsetNumberOfPropertyValues = 24;
+  const size_t headerOffsetNumberOfComposedValueParts = 28;
+  const size_t headerOffsetNumberOfStrings = 32;
+  const size_t headerOffsetStringDataLength = 40;
+
+  // Columns (int64), rows (int64), index of first node (uint32), number of
+  // nodes (uint32)
+  const size_t gameRecordSize = 24;
+  // Index of first child node (int32), index of next sibling node (int32),
+  // index of first property (uint32), number of properties (uint32)
+  const size_t nodeRecordSize = 16;
+  // Index of property name in string table (uint32), index of first property
+  // value (uint32), number of property values (uint32)
+  const size_t propertyRecordSize = 12;
+  // Value type (uint8), flags (uint8), color (uint8), 5 bytes padding,
+  // payload (uint64). Used for both the property value table and the
+  // composed value part table.
+  const size_t propertyValueRecordSize = 16;
+  // Offset into string data (uint64), string length (uint64)
+  const size_t stringRecordSize = 16;
+
+  // Value type marker for a composed property value. The payload is the index
+  // of the first of two consecutive records in the composed value part table.
+  const uint8_t valueTypeComposed = 0xff;
+
+  const uint8_t valueFlagHasTypedValue = 0x01;
+  const uint8_t valueFlagIsGoValue = 0x02;
+  const uint8_t valueFlagIsPassMove = 0x04;
+
+  const int32_t noNodeIndex = -1;
+
+  void AppendUInt8(std::vector<uint8_t>& buffer, uint8_t value)
+  {
+    buffer.push_back(value);
+  }
+
+  void AppendUInt32(std::vector<uint8_t>& buffer, uint32_t value)
+  {
+    for (int byteIndex = 0; byteIndex < 4; byteIndex++)
+      buffer.push_back(static_cast<uint8_t>(value >> (byteIndex * 8)));
+  }
+
+  void AppendUInt64(std::vector<uint8_t>& buffer, uint64_t value)
+  {
+    for (int byteIndex = 0; byteIndex < 8; byteIndex++)
+      buffer.push_back(static_cast<uint8_t>(value >> (byteIndex * 8)));
+  }
+
+  void WriteUInt32(std::vector<uint8_t>& buffer, size_t offset, uint32_t value)
+  {
+    for (int byteIndex = 0; byteIndex < 4; byteIndex++)
+      buffer[offset + byteIndex] = static_cast<uint8_t>(value >> (byteIndex * 8));
+  }
+
+  void WriteUInt64(std::vector<uint8_t>& buffer, size_t offset, uint64_t value)
+  {
+    for (int byteIndex = 0; byteIndex < 8; byteIndex++)
+      buffer[offset + byteIndex] = static_cast<uint8_t>(value >> (byteIndex * 8));
+  }
+
+  uint32_t ReadUInt32(const uint8_t* bytes, size_t offset)
+  {
+    uint32_t value = 0;
+    for (int byteIndex = 3; byteIndex >= 0; byteIndex--)
+      value = (value << 8) | bytes[offset + byteIndex];
+    return value;
+  }
+
+  uint64_t ReadUInt64(const uint8_t* bytes, size_t offset)
+  {
+    uint64_t value = 0;
+    for (int byteIndex = 7; byteIndex >= 0; byteIndex--)
+      value = (value << 8) | bytes[offset + byteIndex];
+    return value;
+  }
+
+  uint64_t DoubleToBits(double value)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  double BitsToDouble(uint64_t bits)
+  {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /// @brief Collects the tables of a snapshot while a document is encoded.
+  struct SnapshotTables
+  {
+    std::vector<uint8_t> GameTable;
+    std::vector<uint8_t> NodeTable;
+    std::vector<uint8_t> PropertyTable;
+    std::vector<uint8_t> PropertyValueTable;
+    std::vector<uint8_t> ComposedValuePartTable;
+    std::vector<std::string> Strings;
+    std::unordered_map<std::string, uint32_t> StringIndexes;
+
+    uint32_t NumberOfNodes = 0;
+    uint32_t NumberOfProperties = 0;
+    uint32_t NumberOfPropertyValues = 0;
+    uint32_t NumberOfComposedValueParts = 0;
+
+    uint32_t IndexOfString(const std::string& string)
+    {
+      auto it = StringIndexes.find(string);
+      if (it != StringIndexes.end())
+        return it->second;
+
+      uint32_t stringIndex = static_cast<uint32_t>(Strings.size());
+      Strings.push_back(string);
+      StringIndexes[string] = stringIndex;
+      return stringIndex;
+    }
+  };
+}
+
+#pragma mark - Class extension
+
+@interface SGFCDocumentSnapshot()
+{
+  // Cached from the header so that the tables can be located without
+  // parsing the header again.
+  const uint8_t* _bytes;
+  uint32_t _numberOfGames;
+  uint32_t _numberOfNodes;
+  uint32_t _numberOfProperties;
+  uint32_t _numberOfPropertyValues;
+  uint32_t _numberOfComposedValueParts;
+  uint32_t _numberOfStrings;
+  size_t _gameTableOffset;
+  size_t _nodeTableOffset;
+  size_t _propertyTableOffset;
+  size_t _propertyValueTableOffset;
+  size_t _composedValuePartTableOffset;
+  size_t _stringTableOffset;
+  size_t _stringDataOffset;
+  uint64_t _stringDataLength;
+}
+
+@property(nonatomic, strong, readwrite) NSData* snapshotData;
+
+@end
+
+@implementation SGFCDocumentSnapshot
+
+#pragma mark - Initialization and deallocation
+
++ (instancetype) snapshotWithData:(NSData*)snapshotData
+{
+  return [[self alloc] initWithData:snapshotData];
+}
+
++ (instancetype) snapshotWithContentsOfFile:(NSString*)snapshotFilePath
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:snapshotFilePath
+                                                 invalidArgumentName:@"snapshotFilePath"];
+
+  NSData* snapshotData = [NSData dataWithContentsOfFile:snapshotFilePath
+                                                options:NSDataReadingMappedIfSafe
+                                                  error:nil];
+  if (snapshotData == nil)
+    return nil;
+
+  return [[self alloc] initWithData:snapshotData];
+}
+
++ (instancetype) snapshotWithDocument:(SGFCDocument*)document
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:document
+                                                 invalidArgumentName:@"document"];
+
+  std::vector<uint8_t> buffer = [SGFCDocumentSnapshot encodeDocument:[document wrappedDocument]];
+  NSData* snapshotData = [NSData dataWithBytes:buffer.data()
+                                        length:buffer.size()];
+
+  return [[self alloc] initWithData:snapshotData];
+}
+
+- (instancetype) initWithData:(NSData*)snapshotData
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:snapshotData
+                                                 invalidArgumentName:@"snapshotData"];
+
+  self.snapshotData = snapshotData;
+  [self parseHeader];
+
+  return self;
+}
+
+- (void) dealloc
+{
+  _bytes = nullptr;
+  self.snapshotData = nil;
+}
+
+#pragma mark - Public API
+
+- (BOOL) writeToFile:(NSString*)snapshotFilePath
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:snapshotFilePath
+                                                 invalidArgumentName:@"snapshotFilePath"];
+
+  return [self.snapshotData writeToFile:snapshotFilePath
+                             atomically:YES];
+}
+
+- (NSUInteger) numberOfGames
+{
+  return _numberOfGames;
+}
+
+- (SGFCGame*) gameAtIndex:(NSUInteger)index
+{
+  if (index >= _numberOfGames)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"index\" is out of range"];
+
+  return [[SGFCGame alloc] initWithWrappedGame:[self decodeGameAtIndex:static_cast<uint32_t>(index)]];
+}
+
+- (SGFCDocument*) document
+{
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>> wrappedGames;
+  for (uint32_t gameIndex = 0; gameIndex < _numberOfGames; gameIndex++)
+    wrappedGames.push_back([self decodeGameAtIndex:gameIndex]);
+
+  auto wrappedDocument = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument();
+  wrappedDocument->SetGames(wrappedGames);
+
+  return [SGFCWrappingUtility wrapDocument:wrappedDocument];
+}
+
+#pragma mark - Private API - Encoding
+
++ (std::vector<uint8_t>) encodeDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument
+{
+  SnapshotTables tables;
+
+  auto wrappedGames = wrappedDocument->GetGames();
+  for (auto wrappedGame : wrappedGames)
+    [SGFCDocumentSnapshot encodeGame:wrappedGame intoTables:tables];
+
+  std::vector<uint8_t> stringTable;
+  std::vector<uint8_t> stringData;
+  for (const auto& string : tables.Strings)
+  {
+    AppendUInt64(stringTable, stringData.size());
+    AppendUInt64(stringTable, string.size());
+    stringData.insert(stringData.end(), string.begin(), string.end());
+  }
+
+  std::vector<uint8_t> buffer(headerSize, 0);
+  std::memcpy(buffer.data(), snapshotMagic, sizeof(snapshotMagic));
+  WriteUInt32(buffer, headerOffsetFormatVersion, snapshotFormatVersion);
+  WriteUInt32(buffer, headerOffsetNumberOfGames, static_cast<uint32_t>(wrappedGames.size()));
+  WriteUInt32(buffer, headerOffsetNumberOfNodes, tables.NumberOfNodes);
+  WriteUInt32(buffer, headerOffsetNumberOfProperties, tables.NumberOfProperties);
+  WriteUInt32(buffer, headerOffsetNumberOfPropertyValues, tables.NumberOfPropertyValues);
+  WriteUInt32(buffer, headerOffsetNumberOfComposedValueParts, tables.NumberOfComposedValueParts);
+  WriteUInt32(buffer, headerOffsetNumberOfStrings, static_cast<uint32_t>(tables.Strings.size()));
+  WriteUInt64(buffer, headerOffsetStringDataLength, stringData.size());
+
+  buffer.reserve(
+    buffer.size() +
+    tables.GameTable.size() +
+    tables.NodeTable.size() +
+    tables.PropertyTable.size() +
+    tables.PropertyValueTable.size() +
+    tables.ComposedValuePartTable.size() +
+    stringTable.size() +
+    stringData.size());
+  buffer.insert(buffer.end(), tables.GameTable.begin(), tables.GameTable.end());
+  buffer.insert(buffer.end(), tables.NodeTable.begin(), tables.NodeTable.end());
+  buffer.insert(buffer.end(), tables.PropertyTable.begin(), tables.PropertyTable.end());
+  buffer.insert(buffer.end(), tables.PropertyValueTable.begin(), tables.PropertyValueTable.end());
+  buffer.insert(buffer.end(), tables.ComposedValuePartTable.begin(), tables.ComposedValuePartTable.end());
+  buffer.insert(buffer.end(), stringTable.begin(), stringTable.end());
+  buffer.insert(buffer.end(), stringData.begin(), stringData.end());
+
+  return buffer;
+}
+
++ (void) encodeGame:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>)wrappedGame
+         intoTables:(SnapshotTables&)tables
+{
+  auto wrappedRootNode = wrappedGame->GetRootNode();
+  if (wrappedRootNode == nullptr)
+    [SGFCExceptionUtility raiseDocumentStructureExceptionWithReason:@"Document contains a game that has no root node"];
+
+  // Collect the nodes in depth-first pre-order. This guarantees that the
+  // index of a node's first child and next sibling is always greater than
+  // the index of the node itself.
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> wrappedNodes;
+  std::unordered_map<const LibSgfcPlusPlus::ISgfcNode*, int32_t> nodeIndexes;
+  std::stack<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> stack;
+  stack.push(wrappedRootNode);
+  while (! stack.empty())
+  {
+    auto wrappedNode = stack.top();
+    stack.pop();
+
+    nodeIndexes[wrappedNode.get()] = static_cast<int32_t>(tables.NumberOfNodes + wrappedNodes.size());
+    wrappedNodes.push_back(wrappedNode);
+
+    auto wrappedNextSibling = wrappedNode->GetNextSibling();
+    if (wrappedNextSibling && wrappedNode != wrappedRootNode)
+      stack.push(wrappedNextSibling);
+    auto wrappedFirstChild = wrappedNode->GetFirstChild();
+    if (wrappedFirstChild)
+      stack.push(wrappedFirstChild);
+  }
+
+  auto boardSize = wrappedGame->GetBoardSize();
+  AppendUInt64(tables.GameTable, static_cast<uint64_t>(boardSize.Columns));
+  AppendUInt64(tables.GameTable, static_cast<uint64_t>(boardSize.Rows));
+  AppendUInt32(tables.GameTable, tables.NumberOfNodes);
+  AppendUInt32(tables.GameTable, static_cast<uint32_t>(wrappedNodes.size()));
+
+  for (auto wrappedNode : wrappedNodes)
+  {
+    auto wrappedFirstChild = wrappedNode->GetFirstChild();
+    auto wrappedNextSibling = (wrappedNode == wrappedRootNode) ? nullptr : wrappedNode->GetNextSibling();
+    int32_t firstChildIndex = wrappedFirstChild ? nodeIndexes[wrappedFirstChild.get()] : noNodeIndex;
+    int32_t nextSiblingIndex = wrappedNextSibling ? nodeIndexes[wrappedNextSibling.get()] : noNodeIndex;
+
+    auto wrappedProperties = wrappedNode->GetProperties();
+
+    AppendUInt32(tables.NodeTable, static_cast<uint32_t>(firstChildIndex));
+    AppendUInt32(tables.NodeTable, static_cast<uint32_t>(nextSiblingIndex));
+    AppendUInt32(tables.NodeTable, tables.NumberOfProperties);
+    AppendUInt32(tables.NodeTable, static_cast<uint32_t>(wrappedProperties.size()));
+
+    for (auto wrappedProperty : wrappedProperties)
+    {
+      auto wrappedPropertyValues = wrappedProperty->GetPropertyValues();
+
+      AppendUInt32(tables.PropertyTable, tables.IndexOfString(wrappedProperty->GetPropertyName()));
+      AppendUInt32(tables.PropertyTable, tables.NumberOfPropertyValues);
+      AppendUInt32(tables.PropertyTable, static_cast<uint32_t>(wrappedPropertyValues.size()));
+
+      for (auto wrappedPropertyValue : wrappedPropertyValues)
+      {
+        if (wrappedPropertyValue->IsComposedValue())
+        {
+          const LibSgfcPlusPlus::ISgfcComposedPropertyValue* composedValue = wrappedPropertyValue->ToComposedValue();
+
+          [SGFCDocumentSnapshot appendValueRecordWithValueType:valueTypeComposed
+                                                         flags:0
+                                                         color:0
+                                                       payload:tables.NumberOfComposedValueParts
+                                                      toBuffer:tables.PropertyValueTable];
+          [SGFCDocumentSnapshot encodeSinglePropertyValue:composedValue->GetValue1().get()
+                                                 toBuffer:tables.ComposedValuePartTable
+                                                   tables:tables];
+          [SGFCDocumentSnapshot encodeSinglePropertyValue:composedValue->GetValue2().get()
+                                                 toBuffer:tables.ComposedValuePartTable
+                                                   tables:tables];
+          tables.NumberOfComposedValueParts += 2;
+        }
+        else
+        {
+          [SGFCDocumentSnapshot encodeSinglePropertyValue:wrappedPropertyValue->ToSingleValue()
+                                                 toBuffer:tables.PropertyValueTable
+                                                   tables:tables];
+        }
+
+        tables.NumberOfPropertyValues++;
+      }
+
+      tables.NumberOfProperties++;
+    }
+  }
+
+  tables.NumberOfNodes += static_cast<uint32_t>(wrappedNodes.size());
+}
+
++ (void) encodeSinglePropertyValue:(const LibSgfcPlusPlus::ISgfcSinglePropertyValue*)singleValue
+                          toBuffer:(std::vector<uint8_t>&)buffer
+                            tables:(SnapshotTables&)tables
+{
+  LibSgfcPlusPlus::SgfcPropertyValueType valueType = singleValue->GetValueType();
+  uint8_t flags = 0;
+  uint8_t color = 0;
+  uint64_t payload = 0;
+
+  if (! singleValue->HasTypedValue())
+  {
+    payload = tables.IndexOfString(singleValue->GetRawValue());
+  }
+  else
+  {
+    flags |= valueFlagHasTypedValue;
+
+    switch (valueType)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Number:
+        payload = static_cast<uint64_t>(singleValue->ToNumberValue()->GetNumberValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Real:
+        payload = DoubleToBits(singleValue->ToRealValue()->GetRealValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Double:
+        payload = static_cast<uint64_t>(singleValue->ToDoubleValue()->GetDoubleValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Color:
+        payload = static_cast<uint64_t>(singleValue->ToColorValue()->GetColorValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::SimpleText:
+        payload = tables.IndexOfString(singleValue->ToSimpleTextValue()->GetSimpleTextValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Text:
+        payload = tables.IndexOfString(singleValue->ToTextValue()->GetTextValue());
+        break;
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Point:
+      {
+        const LibSgfcPlusPlus::ISgfcPointPropertyValue* pointValue = singleValue->ToPointValue();
+        if (pointValue->ToGoPointValue())
+          flags |= valueFlagIsGoValue;
+        payload = tables.IndexOfString(pointValue->GetPointValue());
+        break;
+      }
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Move:
+      {
+        const LibSgfcPlusPlus::ISgfcMovePropertyValue* moveValue = singleValue->ToMoveValue();
+        const LibSgfcPlusPlus::ISgfcGoMovePropertyValue* goMoveValue = moveValue->ToGoMoveValue();
+        if (goMoveValue)
+        {
+          auto goMove = goMoveValue->GetGoMove();
+          flags |= valueFlagIsGoValue;
+          if (goMove->IsPassMove())
+            flags |= valueFlagIsPassMove;
+          color = static_cast<uint8_t>(goMove->GetPlayerColor());
+        }
+        // The raw value tells an empty pass move apart from a "tt" pass move
+        if ((flags & valueFlagIsPassMove) != 0)
+          payload = tables.IndexOfString(singleValue->GetRawValue());
+        else
+          payload = tables.IndexOfString(moveValue->GetMoveValue());
+        break;
+      }
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Stone:
+      {
+        const LibSgfcPlusPlus::ISgfcStonePropertyValue* stoneValue = singleValue->ToStoneValue();
+        const LibSgfcPlusPlus::ISgfcGoStonePropertyValue* goStoneValue = stoneValue->ToGoStoneValue();
+        if (goStoneValue)
+        {
+          flags |= valueFlagIsGoValue;
+          color = static_cast<uint8_t>(goStoneValue->GetGoStone()->GetColor());
+        }
+        payload = tables.IndexOfString(stoneValue->GetStoneValue());
+        break;
+      }
+      default:
+        payload = tables.IndexOfString(singleValue->GetRawValue());
+        break;
+    }
+  }
+
+  [SGFCDocumentSnapshot appendValueRecordWithValueType:static_cast<uint8_t>(valueType)
+                                                 flags:flags
+                                                 color:color
+                                               payload:payload
+                                              toBuffer:buffer];
+}
+
++ (void) appendValueRecordWithValueType:(uint8_t)valueType
+                                  flags:(uint8_t)flags
+                                  color:(uint8_t)color
+                                payload:(uint64_t)payload
+                               toBuffer:(std::vector<uint8_t>&)buffer
+{
+  AppendUInt8(buffer, valueType);
+  AppendUInt8(buffer, flags);
+  AppendUInt8(buffer, color);
+  for (int paddingIndex = 0; paddingIndex < 5; paddingIndex++)
+    AppendUInt8(buffer, 0);
+  AppendUInt64(buffer, payload);
+}
+
+#pragma mark - Private API - Decoding
+
+- (void) parseHeader
+{
+  NSUInteger length = self.snapshotData.length;
+  _bytes = static_cast<const uint8_t*>(self.snapshotData.bytes);
+
+  if (length < headerSize || std::memcmp(_bytes, snapshotMagic, sizeof(snapshotMagic)) != 0)
+    [self raiseMalformedSnapshotException:@"Snapshot header is missing"];
+  if (ReadUInt32(_bytes, headerOffsetFormatVersion) != snapshotFormatVersion)
+    [self raiseMalformedSnapshotException:@"Snapshot format version is not supported"];
+
+  _numberOfGames = ReadUInt32(_bytes, headerOffsetNumberOfGames);
+  _numberOfNodes = ReadUInt32(_bytes, headerOffsetNumberOfNodes);
+  _numberOfProperties = ReadUInt32(_bytes, headerOffsetNumberOfProperties);
+  _numberOfPropertyValues = ReadUInt32(_bytes, headerOffsetNumberOfPropertyValues);
+  _numberOfComposedValueParts = ReadUInt32(_bytes, headerOffsetNumberOfComposedValueParts);
+  _numberOfStrings = ReadUInt32(_bytes, headerOffsetNumberOfStrings);
+  _stringDataLength = ReadUInt64(_bytes, headerOffsetStringDataLength);
+
+  // The record counts are 32-bit values, so none of these computations
+  // can overflow size_t on a 64-bit platform
+  _gameTableOffset = headerSize;
+  _nodeTableOffset = _gameTableOffset + static_cast<size_t>(_numberOfGames) * gameRecordSize;
+  _propertyTableOffset = _nodeTableOffset + static_cast<size_t>(_numberOfNodes) * nodeRecordSize;
+  _propertyValueTableOffset = _propertyTableOffset + static_cast<size_t>(_numberOfProperties) * propertyRecordSize;
+  _composedValuePartTableOffset = _propertyValueTableOffset + static_cast<size_t>(_numberOfPropertyValues) * propertyValueRecordSize;
+  _stringTableOffset = _composedValuePartTableOffset + static_cast<size_t>(_numberOfComposedValueParts) * propertyValueRecordSize;
+  _stringDataOffset = _stringTableOffset + static_cast<size_t>(_numberOfStrings) * stringRecordSize;
+
+  if (_stringDataOffset > length || _stringDataLength != length - _stringDataOffset)
+    [self raiseMalformedSnapshotException:@"Snapshot size does not match the size declared in the header"];
+}
+
+- (std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>) decodeGameAtIndex:(uint32_t)gameIndex
+{
+  size_t gameRecordOffset = _gameTableOffset + static_cast<size_t>(gameIndex) * gameRecordSize;
+  LibSgfcPlusPlus::SgfcBoardSize boardSize;
+  boardSize.Columns = static_cast<LibSgfcPlusPlus::SgfcNumber>(ReadUInt64(_bytes, gameRecordOffset));
+  boardSize.Rows = static_cast<LibSgfcPlusPlus::SgfcNumber>(ReadUInt64(_bytes, gameRecordOffset + 8));
+  uint32_t firstNodeIndex = ReadUInt32(_bytes, gameRecordOffset + 16);
+  uint32_t numberOfNodes = ReadUInt32(_bytes, gameRecordOffset + 20);
+
+  if (numberOfNodes == 0 ||
+      firstNodeIndex > _numberOfNodes ||
+      numberOfNodes > _numberOfNodes - firstNodeIndex)
+  {
+    [self raiseMalformedSnapshotException:@"Game refers to invalid node range"];
+  }
+
+  auto propertyFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> wrappedNodes;
+  wrappedNodes.reserve(numberOfNodes);
+  for (uint32_t nodeIndex = firstNodeIndex; nodeIndex < firstNodeIndex + numberOfNodes; nodeIndex++)
+  {
+    auto wrappedNode = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateNode();
+    wrappedNode->SetProperties([self decodePropertiesOfNodeAtIndex:nodeIndex
+                                                         boardSize:boardSize
+                                                   propertyFactory:propertyFactory
+                                              propertyValueFactory:propertyValueFactory]);
+    wrappedNodes.push_back(wrappedNode);
+  }
+
+  auto wrappedGame = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame(wrappedNodes.front());
+  auto wrappedTreeBuilder = wrappedGame->GetTreeBuilder();
+
+  // The nodes are stored in depth-first pre-order, so when we link a node
+  // to its next sibling, the node itself is already linked to its parent.
+  for (uint32_t localNodeIndex = 0; localNodeIndex < numberOfNodes; localNodeIndex++)
+  {
+    size_t nodeRecordOffset = _nodeTableOffset + static_cast<size_t>(firstNodeIndex + localNodeIndex) * nodeRecordSize;
+    int32_t firstChildIndex = static_cast<int32_t>(ReadUInt32(_bytes, nodeRecordOffset));
+    int32_t nextSiblingIndex = static_cast<int32_t>(ReadUInt32(_bytes, nodeRecordOffset + 4));
+
+    if (firstChildIndex != noNodeIndex)
+    {
+      uint32_t localFirstChildIndex = [self localNodeIndex:firstChildIndex
+                                           afterNodeIndex:localNodeIndex
+                                           firstNodeIndex:firstNodeIndex
+                                            numberOfNodes:numberOfNodes];
+      wrappedTreeBuilder->SetFirstChild(wrappedNodes[localNodeIndex], wrappedNodes[localFirstChildIndex]);
+    }
+
+    if (nextSiblingIndex != noNodeIndex)
+    {
+      if (localNodeIndex == 0)
+        [self raiseMalformedSnapshotException:@"Root node has a sibling"];
+
+      uint32_t localNextSiblingIndex = [self localNodeIndex:nextSiblingIndex
+                                            afterNodeIndex:localNodeIndex
+                                            firstNodeIndex:firstNodeIndex
+                                             numberOfNodes:numberOfNodes];
+      wrappedTreeBuilder->SetNextSibling(wrappedNodes[localNodeIndex], wrappedNodes[localNextSiblingIndex]);
+    }
+  }
+
+  return wrappedGame;
+}
+
+- (uint32_t) localNodeIndex:(int32_t)nodeIndex
+             afterNodeIndex:(uint32_t)localReferenceNodeIndex
+             firstNodeIndex:(uint32_t)firstNodeIndex
+              numberOfNodes:(uint32_t)numberOfNodes
+{
+  // Requiring that links always point forward makes it impossible for a
+  // malformed snapshot to create a cycle
+  if (nodeIndex < 0 ||
+      static_cast<uint32_t>(nodeIndex) <= firstNodeIndex + localReferenceNodeIndex ||
+      static_cast<uint32_t>(nodeIndex) >= firstNodeIndex + numberOfNodes)
+  {
+    [self raiseMalformedSnapshotException:@"Node refers to invalid node index"];
+  }
+
+  return static_cast<uint32_t>(nodeIndex) - firstNodeIndex;
+}
+
+- (std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>>) decodePropertiesOfNodeAtIndex:(uint32_t)nodeIndex
+                                                                                     boardSize:(LibSgfcPlusPlus::SgfcBoardSize)boardSize
+                                                                               propertyFactory:(std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyFactory>)propertyFactory
+                                                                          propertyValueFactory:(std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValueFactory>)propertyValueFactory
+{
+  size_t nodeRecordOffset = _nodeTableOffset + static_cast<size_t>(nodeIndex) * nodeRecordSize;
+  uint32_t firstPropertyIndex = ReadUInt32(_bytes, nodeRecordOffset + 8);
+  uint32_t numberOfProperties = ReadUInt32(_bytes, nodeRecordOffset + 12);
+
+  if (firstPropertyIndex > _numberOfProperties || numberOfProperties > _numberOfProperties - firstPropertyIndex)
+    [self raiseMalformedSnapshotException:@"Node refers to invalid property range"];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>> wrappedProperties;
+  wrappedProperties.reserve(numberOfProperties);
+
+  for (uint32_t propertyIndex = firstPropertyIndex; propertyIndex < firstPropertyIndex + numberOfProperties; propertyIndex++)
+  {
+    size_t propertyRecordOffset = _propertyTableOffset + static_cast<size_t>(propertyIndex) * propertyRecordSize;
+    std::string propertyName = [self stringAtIndex:ReadUInt32(_bytes, propertyRecordOffset)];
+    uint32_t firstValueIndex = ReadUInt32(_bytes, propertyRecordOffset + 4);
+    uint32_t numberOfValues = ReadUInt32(_bytes, propertyRecordOffset + 8);
+
+    if (firstValueIndex > _numberOfPropertyValues || numberOfValues > _numberOfPropertyValues - firstValueIndex)
+      [self raiseMalformedSnapshotException:@"Property refers to invalid property value range"];
+
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>> wrappedPropertyValues;
+    wrappedPropertyValues.reserve(numberOfValues);
+
+    for (uint32_t valueIndex = firstValueIndex; valueIndex < firstValueIndex + numberOfValues; valueIndex++)
+    {
+      size_t valueRecordOffset = _propertyValueTableOffset + static_cast<size_t>(valueIndex) * propertyValueRecordSize;
+      if (_bytes[valueRecordOffset] == valueTypeComposed)
+      {
+        uint64_t firstPartIndex = ReadUInt64(_bytes, valueRecordOffset + 8);
+        if (firstPartIndex >= _numberOfComposedValueParts || _numberOfComposedValueParts - firstPartIndex < 2)
+          [self raiseMalformedSnapshotException:@"Composed property value refers to invalid index"];
+
+        size_t firstPartRecordOffset = _composedValuePartTableOffset + static_cast<size_t>(firstPartIndex) * propertyValueRecordSize;
+        auto value1 = [self decodeSinglePropertyValueAtOffset:firstPartRecordOffset
+                                                    boardSize:boardSize
+                                         propertyValueFactory:propertyValueFactory];
+        auto value2 = [self decodeSinglePropertyValueAtOffset:firstPartRecordOffset + propertyValueRecordSize
+                                                    boardSize:boardSize
+                                         propertyValueFactory:propertyValueFactory];
+        wrappedPropertyValues.push_back(propertyValueFactory->CreateCustomComposedPropertyValue(value1, value2));
+      }
+      else
+      {
+        wrappedPropertyValues.push_back([self decodeSinglePropertyValueAtOffset:valueRecordOffset
+                                                                      boardSize:boardSize
+                                                           propertyValueFactory:propertyValueFactory]);
+      }
+    }
+
+    try
+    {
+      wrappedProperties.push_back(propertyFactory->CreateProperty(propertyName, wrappedPropertyValues));
+    }
+    catch (std::invalid_argument& exception)
+    {
+      [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
+    }
+  }
+
+  return wrappedProperties;
+}
+
+- (std::shared_ptr<LibSgfcPlusPlus::ISgfcSinglePropertyValue>) decodeSinglePropertyValueAtOffset:(size_t)valueRecordOffset
+                                                                                       boardSize:(LibSgfcPlusPlus::SgfcBoardSize)boardSize
+                                                                            propertyValueFactory:(std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValueFactory>)propertyValueFactory
+{
+  auto valueType = static_cast<LibSgfcPlusPlus::SgfcPropertyValueType>(_bytes[valueRecordOffset]);
+  uint8_t flags = _bytes[valueRecordOffset + 1];
+  auto color = static_cast<LibSgfcPlusPlus::SgfcColor>(_bytes[valueRecordOffset + 2]);
+  uint64_t payload = ReadUInt64(_bytes, valueRecordOffset + 8);
+  bool isGoValue = (flags & valueFlagIsGoValue) != 0;
+
+  try
+  {
+    if ((flags & valueFlagHasTypedValue) == 0)
+      return propertyValueFactory->CreateCustomPropertyValue([self stringAtIndex:payload]);
+
+    switch (valueType)
+    {
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Number:
+        return propertyValueFactory->CreateNumberPropertyValue(static_cast<LibSgfcPlusPlus::SgfcNumber>(payload));
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Real:
+        return propertyValueFactory->CreateRealPropertyValue(BitsToDouble(payload));
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Double:
+        return propertyValueFactory->CreateDoublePropertyValue(static_cast<LibSgfcPlusPlus::SgfcDouble>(payload));
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Color:
+        return propertyValueFactory->CreateColorPropertyValue(static_cast<LibSgfcPlusPlus::SgfcColor>(payload));
+      case LibSgfcPlusPlus::SgfcPropertyValueType::SimpleText:
+        return propertyValueFactory->CreateSimpleTextPropertyValue([self stringAtIndex:payload]);
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Text:
+        return propertyValueFactory->CreateTextPropertyValue([self stringAtIndex:payload]);
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Point:
+        if (isGoValue)
+          return propertyValueFactory->CreateGoPointPropertyValue([self stringAtIndex:payload], boardSize);
+        else
+          return propertyValueFactory->CreatePointPropertyValue([self stringAtIndex:payload]);
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Move:
+        if (isGoValue && (flags & valueFlagIsPassMove) != 0)
+        {
+          // libsgfc++ recognizes "tt" as a pass move on boards up to 19x19
+          std::string passMoveValue = [self stringAtIndex:payload];
+          if (passMoveValue.empty())
+            return propertyValueFactory->CreateGoMovePropertyValue(color);
+          else
+            return propertyValueFactory->CreateGoMovePropertyValue(passMoveValue, boardSize, color);
+        }
+        else if (isGoValue)
+          return propertyValueFactory->CreateGoMovePropertyValue([self stringAtIndex:payload], boardSize, color);
+        else
+          return propertyValueFactory->CreateMovePropertyValue([self stringAtIndex:payload]);
+      case LibSgfcPlusPlus::SgfcPropertyValueType::Stone:
+        if (isGoValue)
+          return propertyValueFactory->CreateGoStonePropertyValue([self stringAtIndex:payload], boardSize, color);
+        else
+          return propertyValueFactory->CreateStonePropertyValue([self stringAtIndex:payload]);
+      default:
+        return propertyValueFactory->CreateCustomPropertyValue([self stringAtIndex:payload]);
+    }
+  }
+  catch (std::invalid_argument& exception)
+  {
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
+
+    // Dummy return to make compiler happy (compiler does not see that an
+    // exception is raised)
+    return nullptr;
+  }
+}
+
+- (std::string) stringAtIndex:(uint64_t)stringIndex
+{
+  if (stringIndex >= _numberOfStrings)
+    [self raiseMalformedSnapshotException:@"Invalid string index"];
+
+  size_t stringRecordOffset = _stringTableOffset + static_cast<size_t>(stringIndex) * stringRecordSize;
+  uint64_t stringOffset = ReadUInt64(_bytes, stringRecordOffset);
+  uint64_t stringLength = ReadUInt64(_bytes, stringRecordOffset + 8);
+
+  if (stringOffset > _stringDataLength || stringLength > _stringDataLength - stringOffset)
+    [self raiseMalformedSnapshotException:@"String refers to invalid string data range"];
+
+  const char* stringData = reinterpret_cast<const char*>(_bytes + _stringDataOffset + stringOffset);
+  return std::string(stringData, static_cast<size_t>(stringLength));
+}
+
+- (void) raiseMalformedSnapshotException:(NSString*)detail
+{
+  NSString* reason = [NSString stringWithFormat:@"Snapshot data is malformed: %@", detail];
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:reason];
+}
+
+@end
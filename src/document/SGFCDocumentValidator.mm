@@ -0,0 +1,154 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../include/SGFCDocumentValidator.h"
+#import "../../include/SGFCMessageID.h"
+#import "../interface/internal/SGFCDocumentInternalAdditions.h"
+#import "../interface/internal/SGFCGameInternalAdditions.h"
+#import "../SGFCExceptionUtility.h"
+#import "../SGFCValidationUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+
+// C++ Standard Library includes
+#import <memory>
+#import <tuple>
+#import <vector>
+
+@implementation SGFCDocumentValidator
+
+#pragma mark - Initialization and deallocation
+
++ (instancetype) documentValidator
+{
+  return [[self alloc] init];
+}
+
+- (instancetype) init
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  return self;
+}
+
+#pragma mark - Public API
+
+- (NSArray*) validateDocument:(SGFCDocument*)document
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:document
+                                                 invalidArgumentName:@"document"];
+
+  auto wrappedGames = [document wrappedDocument]->GetGames();
+
+  // Check all games up front so that no work is wasted if the document
+  // cannot be validated
+  for (const auto& wrappedGame : wrappedGames)
+  {
+    if (! wrappedGame->HasRootNode())
+      [SGFCExceptionUtility raiseDocumentStructureExceptionWithReason:@"Document contains one or more games that have no root node"];
+  }
+
+  NSMutableArray* messages = [NSMutableArray array];
+  std::vector<SGFCValidationFinding> findings;
+  NSUInteger gameNumber = 0;
+
+  for (const auto& wrappedGame : wrappedGames)
+  {
+    gameNumber++;
+    findings.clear();
+
+    // SGFC compares the game type of each game to the game type of the
+    // first game
+    if (gameNumber > 1 && wrappedGame->GetGameType() != wrappedGames.front()->GetGameType())
+    {
+      findings.push_back({ SGFCMessageIDDifferentGameTypes, SGFCMessageTypeWarning,
+                           @"game type differs from the game type of the first game" });
+    }
+
+    [SGFCDocumentValidator validateWrappedGame:*wrappedGame findings:findings];
+
+    [messages addObjectsFromArray:[SGFCValidationUtility messagesWithFindings:findings
+                                                                   gameNumber:gameNumber]];
+  }
+
+  return messages;
+}
+
+- (NSArray*) validateGame:(SGFCGame*)game
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:game
+                                                 invalidArgumentName:@"game"];
+
+  auto wrappedGame = [game wrappedGame];
+  if (! wrappedGame->HasRootNode())
+    [SGFCExceptionUtility raiseDocumentStructureExceptionWithReason:@"Game has no root node"];
+
+  std::vector<SGFCValidationFinding> findings;
+  [SGFCDocumentValidator validateWrappedGame:*wrappedGame findings:findings];
+
+  return [SGFCValidationUtility messagesWithFindings:findings
+                                          gameNumber:1];
+}
+
+#pragma mark - Private API
+
+/// @brief Validates @a wrappedGame and its entire game tree and adds the
+/// findings to @a findings. @a wrappedGame must have a root node.
++ (void) validateWrappedGame:(const LibSgfcPlusPlus::ISgfcGame&)wrappedGame
+                    findings:(std::vector<SGFCValidationFinding>&)findings
+{
+  [SGFCValidationUtility validateWrappedGame:wrappedGame findings:findings];
+
+  // Iterate instead of recursing so that deep trees (e.g. long games without
+  // variations) cannot overflow the stack. Each stack entry is a node paired
+  // with the flags that the node's findings depend on. Children are pushed
+  // in reverse order so that they are visited in document order.
+  std::vector<std::tuple<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>, bool, bool>> nodesToVisit;
+  nodesToVisit.emplace_back(wrappedGame.GetRootNode(), true, false);
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> children;
+
+  while (! nodesToVisit.empty())
+  {
+    auto [node, isRootNode, hasGameInfoAncestor] = std::move(nodesToVisit.back());
+    nodesToVisit.pop_back();
+
+    bool hasGameInfo = [SGFCValidationUtility validateWrappedNode:*node
+                                                       isRootNode:isRootNode
+                                              hasGameInfoAncestor:hasGameInfoAncestor
+                                                         findings:findings];
+    bool childrenHaveGameInfoAncestor = hasGameInfoAncestor || hasGameInfo;
+
+    children.clear();
+    for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+      children.push_back(child);
+
+    for (auto it = children.rbegin(); it != children.rend(); ++it)
+      nodesToVisit.emplace_back(*it, false, childrenHaveGameInfoAncestor);
+  }
+}
+
+@end
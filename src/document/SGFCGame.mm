@@ -16,20 +16,31 @@
 
 // Project includes
 #import "../../include/SGFCConstants.h"
+#import "../../include/SGFCDocument.h"
 #import "../../include/SGFCGame.h"
+#import "../interface/internal/SGFCDocumentInternalAdditions.h"
+#import "../interface/internal/SGFCGameHistoryInternalAdditions.h"
 #import "../interface/internal/SGFCGameInternalAdditions.h"
 #import "../interface/internal/SGFCGameInfoInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCNodeInternalAdditions.h"
 #import "../interface/internal/SGFCTreeBuilderInternalAdditions.h"
+#import "../SGFCCloningUtility.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
+#import "../SGFCValidationCache.h"
 #import "../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
 #import <libsgfcplusplus/ISgfcGame.h>
 #import <libsgfcplusplus/ISgfcGoGameInfo.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <algorithm>
+#import <iterator>
+
 #pragma mark - Class extension
 
 @interface SGFCGame()
@@ -38,6 +49,8 @@
 }
 
 @property(nonatomic, strong) SGFCTreeBuilder* treeBuilder;
+@property(nonatomic, strong, readwrite) SGFCGameHistory* history;
+@property(nonatomic, strong) SGFCValidationCache* validationCache;
 
 @end
 
@@ -72,9 +85,12 @@
     _wrappedGame = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame();
   else
     _wrappedGame = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGame([rootNode wrappedNode]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   _rootNode = rootNode;
   self.treeBuilder = [[SGFCTreeBuilder alloc] initWithGame:self];
+  self.validationCache = [[SGFCValidationCache alloc] init];
+  [_rootNode setValidationCache:self.validationCache];
 
   return self;
 }
@@ -95,6 +111,7 @@
     _rootNode = [SGFCWrappingUtility wrapNode:_wrappedGame->GetRootNode()];
   else
     _rootNode = nil;
+  [_rootNode setValidationCache:self.validationCache];
   self.treeBuilder = [[SGFCTreeBuilder alloc] initWithGame:self];
 
   return self;
@@ -106,6 +123,16 @@
   // Don't use property accessor because it does stuff with the wrapped object
   _rootNode = nil;
   self.treeBuilder = nil;
+  self.history = nil;
+  self.validationCache = nil;
+}
+
+#pragma mark - NSCopying overrides
+
+- (id) copyWithZone:(NSZone*)zone
+{
+  auto clonedGame = [SGFCCloningUtility cloneGame:_wrappedGame];
+  return [[[self class] allocWithZone:zone] initWithWrappedGame:clonedGame];
 }
 
 #pragma mark - Public API
@@ -137,17 +164,43 @@
 
 - (void) setRootNode:(SGFCNode*)rootNode
 {
-  if (rootNode)
-    _wrappedGame->SetRootNode([rootNode wrappedNode]);
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"game"];
+
+  SGFCGameHistory* history = self.history;
+  if (history)
+  {
+    auto undoFunction = [history restoreFunctionForRootNode];
+    [self restoreRootNode:rootNode];
+    [history recordChangeWithUndoFunction:undoFunction
+                             redoFunction:[history restoreFunctionForRootNode]];
+  }
   else
-    _wrappedGame->SetRootNode(nullptr);
-
-  _rootNode = rootNode;
+  {
+    [self restoreRootNode:rootNode];
+  }
 }
 
 - (NSArray*) gameInfoNodes
 {
-  return [SGFCWrappingUtility wrapNodes:_wrappedGame->GetGameInfoNodes()];
+  NSArray* gameInfoNodes = [SGFCWrappingUtility wrapNodes:_wrappedGame->GetGameInfoNodes()];
+
+  if (_frozen)
+  {
+    for (SGFCNode* gameInfoNode in gameInfoNodes)
+      [gameInfoNode freeze];
+  }
+
+  if (self.history)
+  {
+    for (SGFCNode* gameInfoNode in gameInfoNodes)
+      [gameInfoNode setHistory:self.history];
+  }
+
+  for (SGFCNode* gameInfoNode in gameInfoNodes)
+    [gameInfoNode setValidationCache:self.validationCache];
+
+  return gameInfoNodes;
 }
 
 - (SGFCGameInfo*) gameInfo
@@ -157,10 +210,65 @@
 
 - (void) writeGameInfo:(SGFCGameInfo*)gameInfo
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"game"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:gameInfo
                                                  invalidArgumentName:@"gameInfo"];
 
+  SGFCGameHistory* history = self.history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  if (history)
+    undoFunction = [self restoreFunctionForGameInfoWithHistory:history];
+
   _wrappedGame->WriteGameInfo(gameInfo.wrappedGameInfo);
+
+  // WriteGameInfo() creates a new root node if the game has none
+  if (! _rootNode && _wrappedGame->HasRootNode())
+  {
+    _rootNode = [SGFCWrappingUtility wrapNode:_wrappedGame->GetRootNode()];
+    [_rootNode setHistory:history];
+    [_rootNode setValidationCache:self.validationCache];
+  }
+
+  if (history)
+  {
+    [history recordChangeWithUndoFunction:undoFunction
+                             redoFunction:[self restoreFunctionForGameInfoWithHistory:history]];
+  }
+
+  // WriteGameInfo() writes to the root node and to the first game info node
+  [self.validationCache propertiesOfNodeDidChange:_wrappedGame->GetRootNode()];
+  auto wrappedGameInfoNodes = _wrappedGame->GetGameInfoNodes();
+  if (! wrappedGameInfoNodes.empty())
+    [self.validationCache propertiesOfNodeDidChange:wrappedGameInfoNodes.front()];
+}
+
+- (NSArray*) validateIncrementally
+{
+  return [self validateIncrementallyWithGameNumber:1];
+}
+
+- (NSArray*) validateIncrementallyInDocument:(SGFCDocument*)document
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:document
+                                                 invalidArgumentName:@"document"];
+
+  auto wrappedGames = [document wrappedDocument]->GetGames();
+  auto it = std::find(wrappedGames.begin(), wrappedGames.end(), _wrappedGame);
+  if (it == wrappedGames.end())
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"document\" does not contain the game"];
+
+  NSUInteger gameNumber = std::distance(wrappedGames.begin(), it) + 1;
+  return [self validateIncrementallyWithGameNumber:gameNumber];
+}
+
+- (void) enableHistory
+{
+  if (self.history)
+    return;
+
+  self.history = [[SGFCGameHistory alloc] initWithGame:self];
+  [_rootNode setHistory:self.history];
 }
 
 #pragma mark - Internal API - SGFCGameInternalAdditions overrides
@@ -170,4 +278,65 @@
   return _wrappedGame;
 }
 
+- (void) restoreRootNode:(SGFCNode*)rootNode
+{
+  if (rootNode)
+    _wrappedGame->SetRootNode([rootNode wrappedNode]);
+  else
+    _wrappedGame->SetRootNode(nullptr);
+
+  _rootNode = rootNode;
+  if (self.history)
+    [_rootNode setHistory:self.history];
+  [_rootNode setValidationCache:self.validationCache];
+}
+
+- (void) freeze
+{
+  if (_frozen)
+    return;
+
+  [_rootNode freeze];
+
+  _frozen = YES;
+}
+
+#pragma mark - Private API
+
+// Validates the game tree with the validation cache. The messages refer to
+// the game with the 1-based number @a gameNumber.
+- (NSArray*) validateIncrementallyWithGameNumber:(NSUInteger)gameNumber
+{
+  if (! _wrappedGame->HasRootNode())
+    [SGFCExceptionUtility raiseDocumentStructureExceptionWithReason:@"Game has no root node"];
+
+  return [self.validationCache validateWrappedGame:*_wrappedGame
+                                           history:self.history
+                                        gameNumber:gameNumber];
+}
+
+// Returns a function that restores the root node, and the properties of the
+// nodes that writeGameInfo:() writes to, to their current state.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForGameInfoWithHistory:(SGFCGameHistory*)history
+{
+  auto restoreRootNode = [history restoreFunctionForRootNode];
+  SGFCGameHistoryRestoreFunction restoreRootNodeProperties = []() {};
+  SGFCGameHistoryRestoreFunction restoreGameInfoNodeProperties = []() {};
+
+  auto wrappedRootNode = _wrappedGame->GetRootNode();
+  if (wrappedRootNode)
+    restoreRootNodeProperties = [history restoreFunctionForPropertiesOfNode:wrappedRootNode];
+
+  auto wrappedGameInfoNodes = _wrappedGame->GetGameInfoNodes();
+  if (! wrappedGameInfoNodes.empty() && wrappedGameInfoNodes.front() != wrappedRootNode)
+    restoreGameInfoNodeProperties = [history restoreFunctionForPropertiesOfNode:wrappedGameInfoNodes.front()];
+
+  return [restoreRootNode, restoreRootNodeProperties, restoreGameInfoNodeProperties]()
+  {
+    restoreRootNode();
+    restoreRootNodeProperties();
+    restoreGameInfoNodeProperties();
+  };
+}
+
 @end
@@ -0,0 +1,351 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../include/SGFCGameHistory.h"
+#import "../interface/internal/SGFCGameHistoryInternalAdditions.h"
+#import "../interface/internal/SGFCGameInternalAdditions.h"
+#import "../SGFCExceptionUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcPropertyValue.h>
+#import <libsgfcplusplus/ISgfcTreeBuilder.h>
+
+// C++ Standard Library includes
+#import <utility>
+#import <vector>
+
+#pragma mark - Helper functions
+
+namespace
+{
+  // A recorded change consists of a function that reverts the change and a
+  // function that applies the change again
+  struct SGFCGameHistoryChange
+  {
+    SGFCGameHistoryRestoreFunction UndoFunction;
+    SGFCGameHistoryRestoreFunction RedoFunction;
+  };
+
+  typedef std::vector<SGFCGameHistoryChange> SGFCGameHistoryVersion;
+
+  // Makes @a children the children of @a parent, in the given order. Nodes
+  // in @a children that are currently located elsewhere in the game tree are
+  // moved, together with their sub trees.
+  void SetChildren(
+    const std::shared_ptr<LibSgfcPlusPlus::ISgfcTreeBuilder>& treeBuilder,
+    const std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>& parent,
+    const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>>& children)
+  {
+    if (children.empty())
+    {
+      treeBuilder->SetFirstChild(parent, nullptr);
+      return;
+    }
+
+    treeBuilder->SetFirstChild(parent, children.front());
+    for (size_t indexOfChild = 1; indexOfChild < children.size(); indexOfChild++)
+      treeBuilder->SetNextSibling(children[indexOfChild - 1], children[indexOfChild]);
+    treeBuilder->SetNextSibling(children.back(), nullptr);
+  }
+}
+
+#pragma mark - Class extension
+
+@interface SGFCGameHistory()
+{
+  // Changes recorded since commitVersion was last invoked
+  SGFCGameHistoryVersion _uncommittedVersion;
+  std::vector<SGFCGameHistoryVersion> _undoVersions;
+  std::vector<SGFCGameHistoryVersion> _redoVersions;
+  NSUInteger _undoRedoCount;
+}
+
+- (instancetype) initWithGame:(SGFCGame*)game NS_DESIGNATED_INITIALIZER;
+
+@property(nonatomic, weak, readwrite) SGFCGame* game;
+
+@end
+
+@implementation SGFCGameHistory
+
+#pragma mark - Initialization and deallocation
+
+- (instancetype) initWithGame:(SGFCGame*)game
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:game
+                                                 invalidArgumentName:@"game"];
+
+  self.game = game;
+
+  return self;
+}
+
+- (void) dealloc
+{
+  self.game = nil;
+}
+
+#pragma mark - Public API
+
+- (BOOL) canUndo
+{
+  return ! _undoVersions.empty() || ! _uncommittedVersion.empty();
+}
+
+- (BOOL) canRedo
+{
+  return ! _redoVersions.empty();
+}
+
+- (BOOL) hasUncommittedChanges
+{
+  return ! _uncommittedVersion.empty();
+}
+
+- (void) commitVersion
+{
+  if (_uncommittedVersion.empty())
+    return;
+
+  _undoVersions.push_back(std::move(_uncommittedVersion));
+  _uncommittedVersion.clear();
+}
+
+- (void) undo
+{
+  if (! self.canUndo)
+    [SGFCExceptionUtility raiseInvalidOperationExceptionWithReason:@"There is no version to undo"];
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:self.game.isFrozen
+                                                    objectName:@"game"];
+
+  [self commitVersion];
+
+  SGFCGameHistoryVersion version = std::move(_undoVersions.back());
+  _undoVersions.pop_back();
+
+  // Changes must be reverted in the reverse order in which they were made
+  try
+  {
+    for (auto iterator = version.rbegin(); iterator != version.rend(); ++iterator)
+      iterator->UndoFunction();
+  }
+  catch (std::invalid_argument& exception)
+  {
+    [SGFCExceptionUtility raiseInternalInconsistencyExceptionWithCStringReason:exception.what()];
+  }
+
+  _redoVersions.push_back(std::move(version));
+  _undoRedoCount++;
+}
+
+- (void) redo
+{
+  if (! self.canRedo)
+    [SGFCExceptionUtility raiseInvalidOperationExceptionWithReason:@"There is no version to redo"];
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:self.game.isFrozen
+                                                    objectName:@"game"];
+
+  SGFCGameHistoryVersion version = std::move(_redoVersions.back());
+  _redoVersions.pop_back();
+
+  try
+  {
+    for (const auto& change : version)
+      change.RedoFunction();
+  }
+  catch (std::invalid_argument& exception)
+  {
+    [SGFCExceptionUtility raiseInternalInconsistencyExceptionWithCStringReason:exception.what()];
+  }
+
+  _undoVersions.push_back(std::move(version));
+  _undoRedoCount++;
+}
+
+- (void) removeAllVersions
+{
+  _uncommittedVersion.clear();
+  _undoVersions.clear();
+  _redoVersions.clear();
+}
+
+#pragma mark - Internal API - SGFCGameHistoryInternalAdditions overrides
+
+- (NSUInteger) undoRedoCount
+{
+  return _undoRedoCount;
+}
+
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForPropertiesOfNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  // Property objects are not immutable, so their values must be captured as
+  // well. Property value objects are immutable and can be shared.
+  std::vector<std::pair<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>, std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>>> propertiesState;
+  for (const auto& property : node->GetProperties())
+    propertiesState.emplace_back(property, property->GetPropertyValues());
+
+  return [node, propertiesState]()
+  {
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>> properties;
+    properties.reserve(propertiesState.size());
+
+    for (const auto& [property, propertyValues] : propertiesState)
+    {
+      property->SetPropertyValues(propertyValues);
+      properties.push_back(property);
+    }
+
+    node->SetProperties(properties);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForValuesOfProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+{
+  auto propertyValues = property->GetPropertyValues();
+
+  return [property, propertyValues]()
+  {
+    property->SetPropertyValues(propertyValues);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) setFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                      node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  return [property, node]()
+  {
+    node->SetProperty(property);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) appendFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  return [property, node]()
+  {
+    node->AppendProperty(property);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) insertFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                        index:(NSUInteger)indexOfProperty
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  return [property, indexOfProperty, node]()
+  {
+    // libsgfc++ cannot insert a single property, but appending is cheap and
+    // covers the common case that the last property was removed
+    auto properties = node->GetProperties();
+    if (indexOfProperty >= properties.size())
+    {
+      node->AppendProperty(property);
+    }
+    else
+    {
+      properties.insert(properties.begin() + indexOfProperty, property);
+      node->SetProperties(properties);
+    }
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) removeFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  return [property, node]()
+  {
+    node->RemoveProperty(property);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) appendFunctionWithPropertyValues:(std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>)propertyValues
+                                                           property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+{
+  return [propertyValues, property]()
+  {
+    for (const auto& propertyValue : propertyValues)
+      property->AppendPropertyValue(propertyValue);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) insertFunctionWithPropertyValue:(std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>)propertyValue
+                                                             index:(NSUInteger)indexOfPropertyValue
+                                                          property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+{
+  return [propertyValue, indexOfPropertyValue, property]()
+  {
+    auto propertyValues = property->GetPropertyValues();
+    if (indexOfPropertyValue >= propertyValues.size())
+    {
+      property->AppendPropertyValue(propertyValue);
+    }
+    else
+    {
+      propertyValues.insert(propertyValues.begin() + indexOfPropertyValue, propertyValue);
+      property->SetPropertyValues(propertyValues);
+    }
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) removeFunctionWithPropertyValues:(std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>)propertyValues
+                                                           property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+{
+  return [propertyValues, property]()
+  {
+    for (const auto& propertyValue : propertyValues)
+      property->RemovePropertyValue(propertyValue);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForChildrenOfNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  if (node == nullptr)
+    return []() {};
+
+  auto children = node->GetChildren();
+  auto treeBuilder = [self.game wrappedGame]->GetTreeBuilder();
+
+  return [treeBuilder, node, children]()
+  {
+    SetChildren(treeBuilder, node, children);
+  };
+}
+
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForRootNode
+{
+  __weak SGFCGame* game = self.game;
+  SGFCNode* rootNode = game.rootNode;
+
+  return [game, rootNode]()
+  {
+    [game restoreRootNode:rootNode];
+  };
+}
+
+- (void) recordChangeWithUndoFunction:(SGFCGameHistoryRestoreFunction)undoFunction
+                         redoFunction:(SGFCGameHistoryRestoreFunction)redoFunction
+{
+  _uncommittedVersion.push_back({ undoFunction, redoFunction });
+  _redoVersions.clear();
+}
+
+@end
@@ -15,12 +15,17 @@
 // -----------------------------------------------------------------------------
 
 // Project includes
+#import "../../include/SGFCConstants.h"
 #import "../../include/SGFCNode.h"
+#import "../interface/internal/SGFCGameHistoryInternalAdditions.h"
 #import "../interface/internal/SGFCGameInfoInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCNodeInternalAdditions.h"
 #import "../interface/internal/SGFCPropertyInternalAdditions.h"
+#import "../SGFCCloningUtility.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
+#import "../SGFCValidationCache.h"
 #import "../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
@@ -30,12 +35,32 @@
 
 // System includes
 #import <Foundation/NSArray.h>
+#import <Foundation/NSDictionary.h>
+#import <Foundation/NSException.h>
+#import <Foundation/NSValue.h>
+
+// C++ Standard Library includes
+#import <vector>
 
 #pragma mark - Class extension
 
 @interface SGFCNode()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> _wrappedNode;
+  // Must be declared explicitly because both the getter and the setter of
+  // the property are implemented manually
+  NSArray* _properties;
+  NSUInteger _batchUpdateNestingLevel;
+  BOOL _propertiesNeedUpdate;
+  // SGFCProperty objects that were added during a batch update and that are
+  // not yet in _properties
+  NSMutableArray* _propertiesAddedInBatchUpdate;
+  __weak SGFCGameHistory* _history;
+  // The value of _history's undoRedoCount when _properties was last
+  // synchronized with the wrapped node. An undo or redo may have modified
+  // the wrapped node if the value has changed since then.
+  NSUInteger _undoRedoCount;
+  SGFCValidationCache* _validationCache;
 }
 @end
 
@@ -56,6 +81,7 @@
     return nil;
 
   _wrappedNode = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateNode();
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   _properties = [NSArray array];
 
   return self;
@@ -81,6 +107,8 @@
   _wrappedNode = nullptr;
   // Don't use property accessor because of nil check
   _properties = nil;
+  _propertiesAddedInBatchUpdate = nil;
+  _validationCache = nil;
 }
 
 #pragma mark - NSObject overrides
@@ -112,6 +140,14 @@
   return reinterpret_cast<NSUInteger>(_wrappedNode.get());
 }
 
+#pragma mark - NSCopying overrides
+
+- (id) copyWithZone:(NSZone*)zone
+{
+  auto clonedNode = [SGFCCloningUtility cloneNode:_wrappedNode];
+  return [[[self class] allocWithZone:zone] initWithWrappedNode:clonedNode];
+}
+
 #pragma mark - Public API - Game tree navigation
 
 - (SGFCNode*) firstChild
@@ -203,7 +239,7 @@
 
 - (SGFCNode*) root
 {
-  return [SGFCWrappingUtility wrapNode:_wrappedNode->GetRoot()];
+  return [self nodeOrNil:_wrappedNode->GetRoot()];
 }
 
 - (SGFCNode*) gameInfoNode
@@ -213,7 +249,12 @@
 
 - (NSArray*) mainVariationNodes
 {
-  return [SGFCWrappingUtility wrapNodes:_wrappedNode->GetMainVariationNodes()];
+  NSArray* mainVariationNodes = [SGFCWrappingUtility wrapNodes:_wrappedNode->GetMainVariationNodes()];
+
+  for (SGFCNode* mainVariationNode in mainVariationNodes)
+    [self passStateToNode:mainVariationNode];
+
+  return mainVariationNodes;
 }
 
 #pragma mark - Public API - Game info access
@@ -225,10 +266,33 @@
 
 - (void) writeGameInfo:(SGFCGameInfo*)gameInfo
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:gameInfo
                                                  invalidArgumentName:@"gameInfo"];
 
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  if (history)
+    undoFunction = [self restoreFunctionForGameInfoWithHistory:history];
+
   _wrappedNode->WriteGameInfo(gameInfo.wrappedGameInfo);
+
+  if (history)
+  {
+    [history recordChangeWithUndoFunction:undoFunction
+                             redoFunction:[self restoreFunctionForGameInfoWithHistory:history]];
+  }
+
+  if (_validationCache)
+  {
+    [_validationCache propertiesOfNodeDidChange:_wrappedNode->GetRoot()];
+    [_validationCache propertiesOfNodeDidChange:_wrappedNode];
+    [_validationCache propertiesOfNodeDidChange:_wrappedNode->GetGameInfoNode()];
+  }
+
+  // WriteGameInfo() may have modified the properties of this node
+  [self updatePropertiesWithAddedProperties:nil];
 }
 
 #pragma mark - Public API - Property access
@@ -238,8 +302,20 @@
   return [SGFCMappingUtility toSgfcKitBoolean:_wrappedNode->HasProperties()];
 }
 
+- (NSArray*) properties
+{
+  if (_propertiesNeedUpdate)
+    [self updateProperties];
+  else if (! _frozen && _undoRedoCount != [_history undoRedoCount])
+    [self updatePropertiesWithAddedProperties:nil];
+
+  return _properties;
+}
+
 - (void) setProperties:(NSArray*)properties
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:properties
                                                  invalidArgumentName:@"properties"];
 
@@ -256,6 +332,8 @@
     wrappedProperties.push_back([property wrappedProperty]);
   }
 
+  auto undoFunction = [self restoreFunctionForProperties];
+
   try
   {
     _wrappedNode->SetProperties(wrappedProperties);
@@ -265,67 +343,157 @@
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
+  [self recordPropertiesChangeWithUndoFunction:undoFunction];
+
+  for (SGFCProperty* property in properties)
+    [self passStateToProperty:property];
+
   _properties = properties;
+  _undoRedoCount = [_history undoRedoCount];
+  _propertiesNeedUpdate = NO;
+  [_propertiesAddedInBatchUpdate removeAllObjects];
 }
 
 - (void) setProperty:(SGFCProperty*)property
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:property
                                                  invalidArgumentName:@"property"];
 
-  _wrappedNode->SetProperty([property wrappedProperty]);
-  _properties = [SGFCWrappingUtility wrapProperties:_wrappedNode->GetProperties()];
+  auto wrappedProperty = [property wrappedProperty];
+
+  // Record only the delta, not the entire collection of properties
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (history)
+  {
+    undoFunction = [self undoFunctionForSettingProperty:wrappedProperty history:history];
+    redoFunction = [history setFunctionWithProperty:wrappedProperty node:_wrappedNode];
+  }
+
+  _wrappedNode->SetProperty(wrappedProperty);
+  [self recordPropertiesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+
+  [self propertiesDidChangeWithAddedProperty:property];
 }
 
 - (void) appendProperty:(SGFCProperty*)property
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:property
                                                  invalidArgumentName:@"property"];
 
+  auto wrappedProperty = [property wrappedProperty];
+
   try
   {
-    _wrappedNode->SetProperty([property wrappedProperty]);
+    _wrappedNode->AppendProperty(wrappedProperty);
   }
   catch (std::invalid_argument& exception)
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
-  _properties = [SGFCWrappingUtility wrapProperties:_wrappedNode->GetProperties()];
+  // Record only the delta, not the entire collection of properties
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (history)
+  {
+    undoFunction = [history removeFunctionWithProperty:wrappedProperty node:_wrappedNode];
+    redoFunction = [history appendFunctionWithProperty:wrappedProperty node:_wrappedNode];
+  }
+
+  [self recordPropertiesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+
+  [self propertiesDidChangeWithAddedProperty:property];
 }
 
 - (void) removeProperty:(SGFCProperty*)property
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:property
                                                  invalidArgumentName:@"property"];
 
+  auto wrappedProperty = [property wrappedProperty];
+
+  // Record only the delta, not the entire collection of properties
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (history)
+  {
+    NSUInteger indexOfProperty = [self indexOfWrappedProperty:wrappedProperty];
+    if (indexOfProperty != NSNotFound)
+    {
+      undoFunction = [history insertFunctionWithProperty:wrappedProperty index:indexOfProperty node:_wrappedNode];
+      redoFunction = [history removeFunctionWithProperty:wrappedProperty node:_wrappedNode];
+    }
+  }
+
   try
   {
-    _wrappedNode->RemoveProperty([property wrappedProperty]);
+    _wrappedNode->RemoveProperty(wrappedProperty);
   }
   catch (std::invalid_argument& exception)
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
-  _properties = [SGFCWrappingUtility wrapProperties:_wrappedNode->GetProperties()];
+  [self recordPropertiesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+
+  [self propertiesDidChangeWithAddedProperty:nil];
 }
 
 - (void) removeAllProperties
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
+
+  auto undoFunction = [self restoreFunctionForProperties];
   _wrappedNode->RemoveAllProperties();
-  _properties = [SGFCWrappingUtility wrapProperties:_wrappedNode->GetProperties()];
+  [self recordPropertiesChangeWithUndoFunction:undoFunction];
+
+  // No need to compare anything, the result is known
+  _properties = [NSArray array];
+  _propertiesNeedUpdate = NO;
+  [_propertiesAddedInBatchUpdate removeAllObjects];
+}
+
+- (void) performBatchUpdates:(void (^)(void))updates
+{
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"node"];
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:updates
+                                                 invalidArgumentName:@"updates"];
+
+  _batchUpdateNestingLevel++;
+
+  @try
+  {
+    updates();
+  }
+  @finally
+  {
+    _batchUpdateNestingLevel--;
+
+    if (_batchUpdateNestingLevel == 0 && _propertiesNeedUpdate)
+      [self updateProperties];
+  }
 }
 
 - (SGFCProperty*) propertyWithType:(SGFCPropertyType)propertyType
 {
   auto propertyWithType = _wrappedNode->GetProperty(
     [SGFCMappingUtility fromSgfcKitPropertyType:propertyType]);
-
   if (propertyWithType == nullptr)
     return nil;
   else
-    return [SGFCWrappingUtility wrapProperty:propertyWithType];
+    return [self propertyWrappingProperty:propertyWithType];
 }
 
 - (SGFCProperty*) propertyWithName:(NSString*)propertyName
@@ -333,13 +501,19 @@
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:propertyName
                                                  invalidArgumentName:@"propertyName"];
 
+  // A property with a name that is defined by the SGF standard always has
+  // the corresponding property type, so for these names we can look up the
+  // property by type and avoid the NSString to std::string conversion
+  NSNumber* propertyTypeAsNumber = SGFCPropertyNameToPropertyTypeMap[propertyName];
+  if (propertyTypeAsNumber)
+    return [self propertyWithType:static_cast<SGFCPropertyType>(propertyTypeAsNumber.unsignedIntegerValue)];
+
   auto propertyWithName = _wrappedNode->GetProperty(
     [SGFCMappingUtility fromSgfcKitString:propertyName]);
-
   if (propertyWithName == nullptr)
     return nil;
   else
-    return [SGFCWrappingUtility wrapProperty:propertyWithName];
+    return [self propertyWrappingProperty:propertyWithName];
 }
 
 - (NSArray*) propertiesWithCategory:(SGFCPropertyCategory)propertyCategory
@@ -347,14 +521,29 @@
   auto propertiesWithCategory = _wrappedNode->GetProperties(
     [SGFCMappingUtility fromSgfcKitPropertyCategory:propertyCategory]);
 
-  return [SGFCWrappingUtility wrapProperties:propertiesWithCategory];
+  return [self passStateToProperties:[SGFCWrappingUtility wrapProperties:propertiesWithCategory]];
 }
 
 - (NSArray*) inheritedProperties
 {
   auto inheritedProperties = _wrappedNode->GetInheritedProperties();
+  NSArray* properties = [self passStateToProperties:[SGFCWrappingUtility wrapProperties:inheritedProperties]];
+
+  // Inherited properties are usually located in an ancestor node. A change
+  // made through the SGFCProperty object must be reported to the validation
+  // cache as a change of that node.
+  if (_validationCache)
+  {
+    NSUInteger indexOfProperty = 0;
+    for (const auto& inheritedProperty : inheritedProperties)
+    {
+      SGFCProperty* property = [properties objectAtIndex:indexOfProperty++];
+      [property setValidationCache:_validationCache
+                              node:[self nodeContainingInheritedProperty:inheritedProperty]];
+    }
+  }
 
-  return [SGFCWrappingUtility wrapProperties:inheritedProperties];
+  return properties;
 }
 
 #pragma mark - Internal API - SGFCNodeInternalAdditions overrides
@@ -364,14 +553,344 @@
   return _wrappedNode;
 }
 
+- (void) setHistory:(SGFCGameHistory*)history
+{
+  if (history != _history)
+  {
+    _history = history;
+    _undoRedoCount = [history undoRedoCount];
+  }
+
+  for (SGFCProperty* property in _properties)
+    [property setHistory:history];
+}
+
+- (void) setValidationCache:(SGFCValidationCache*)validationCache
+{
+  _validationCache = validationCache;
+
+  for (SGFCProperty* property in _properties)
+    [property setValidationCache:validationCache node:_wrappedNode];
+}
+
+- (void) freeze
+{
+  if (_frozen)
+    return;
+
+  // Once the node is frozen the lazy updates in the property getters must
+  // no longer write to member variables, because other threads may read
+  // the node concurrently. Do all outstanding work now.
+  if (_propertiesNeedUpdate)
+    [self updateProperties];
+  else if (_undoRedoCount != [_history undoRedoCount])
+    [self updatePropertiesWithAddedProperties:nil];
+
+  for (SGFCProperty* property in _properties)
+    [property freeze];
+
+  _frozen = YES;
+}
+
 #pragma mark - Private API
 
+// Is invoked after the wrapped node's collection of properties has changed.
+// @a property is the property that was added by the change, or nil if the
+// change did not add a property.
+- (void) propertiesDidChangeWithAddedProperty:(SGFCProperty*)property
+{
+  if (_batchUpdateNestingLevel == 0)
+  {
+    [self updatePropertiesWithAddedProperties:(property ? @[property] : nil)];
+  }
+  else
+  {
+    if (property)
+    {
+      if (! _propertiesAddedInBatchUpdate)
+        _propertiesAddedInBatchUpdate = [NSMutableArray array];
+      [_propertiesAddedInBatchUpdate addObject:property];
+    }
+
+    _propertiesNeedUpdate = YES;
+  }
+}
+
+- (void) updateProperties
+{
+  [self updatePropertiesWithAddedProperties:_propertiesAddedInBatchUpdate];
+
+  _propertiesNeedUpdate = NO;
+  [_propertiesAddedInBatchUpdate removeAllObjects];
+}
+
+// Synchronizes _properties with the wrapped node's collection of properties.
+// SGFCProperty objects that are already in _properties, or that are in
+// @a addedProperties, are reused. Only properties that were added to the
+// wrapped node without going through SGFCNode get a new wrapper object.
+- (void) updatePropertiesWithAddedProperties:(NSArray*)addedProperties
+{
+  auto wrappedProperties = _wrappedNode->GetProperties();
+  NSMutableArray* properties = [NSMutableArray arrayWithCapacity:wrappedProperties.size()];
+
+  // Most changes either append a property or remove a property, so in the
+  // common case the existing properties are found in the same order as
+  // before. The search for each wrapped property therefore starts at the
+  // position where the previous search ended.
+  NSUInteger numberOfExistingProperties = _properties.count;
+  NSUInteger searchStartIndex = 0;
+
+  for (auto wrappedProperty : wrappedProperties)
+  {
+    SGFCProperty* matchingProperty = nil;
+
+    for (NSUInteger searchCount = 0; searchCount < numberOfExistingProperties; searchCount++)
+    {
+      NSUInteger searchIndex = (searchStartIndex + searchCount) % numberOfExistingProperties;
+      SGFCProperty* existingProperty = [_properties objectAtIndex:searchIndex];
+      if ([existingProperty wrappedProperty] == wrappedProperty)
+      {
+        matchingProperty = existingProperty;
+        searchStartIndex = searchIndex + 1;
+        break;
+      }
+    }
+
+    if (! matchingProperty)
+    {
+      for (SGFCProperty* addedProperty in addedProperties)
+      {
+        if ([addedProperty wrappedProperty] == wrappedProperty)
+        {
+          matchingProperty = addedProperty;
+          break;
+        }
+      }
+    }
+
+    if (! matchingProperty)
+      matchingProperty = [SGFCWrappingUtility wrapProperty:wrappedProperty];
+
+    [properties addObject:matchingProperty];
+  }
+
+  if (_history)
+  {
+    for (SGFCProperty* property in properties)
+      [property setHistory:_history];
+  }
+
+  if (_validationCache)
+  {
+    for (SGFCProperty* property in properties)
+      [property setValidationCache:_validationCache node:_wrappedNode];
+  }
+
+  _properties = properties;
+  _undoRedoCount = [_history undoRedoCount];
+}
+
+// Returns the SGFCProperty object in the properties collection that wraps
+// @a wrappedProperty. @a wrappedProperty must be the result of a lookup in
+// the wrapped node that was made just now, so the lookup itself is never
+// stale. If no object wraps @a wrappedProperty, e.g. because the wrapped
+// node was modified through a different SGFCNode object, the properties
+// collection is synchronized first. A frozen node cannot synchronize, in
+// that case a new SGFCProperty object is returned.
+- (SGFCProperty*) propertyWrappingProperty:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>&)wrappedProperty
+{
+  for (SGFCProperty* property in self.properties)
+  {
+    if ([property wrappedProperty] == wrappedProperty)
+      return property;
+  }
+
+  if (! _frozen)
+  {
+    [self updatePropertiesWithAddedProperties:nil];
+
+    for (SGFCProperty* property in _properties)
+    {
+      if ([property wrappedProperty] == wrappedProperty)
+        return property;
+    }
+  }
+
+  SGFCProperty* property = [SGFCWrappingUtility wrapProperty:wrappedProperty];
+  [self passStateToProperty:property];
+  return property;
+}
+
+// Returns the wrapped node or the ancestor of the wrapped node that contains
+// @a inheritedProperty. Returns nullptr if no such node exists.
+- (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) nodeContainingInheritedProperty:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>&)inheritedProperty
+{
+  for (auto node = _wrappedNode; node != nullptr; node = node->GetParent())
+  {
+    for (const auto& property : node->GetProperties())
+    {
+      if (property == inheritedProperty)
+        return node;
+    }
+  }
+
+  return nullptr;
+}
+
+// Returns nil if @a wrappedNode is nullptr. Otherwise returns a new SGFCNode
+// object that wraps @a wrappedNode and that has the same state as this node.
 - (SGFCNode*) nodeOrNil:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)wrappedNode
 {
   if (wrappedNode == nullptr)
     return nil;
-  else
-    return [SGFCWrappingUtility wrapNode:wrappedNode];
+
+  SGFCNode* node = [SGFCWrappingUtility wrapNode:wrappedNode];
+  [self passStateToNode:node];
+
+  return node;
+}
+
+// Freezes @a node if this node is frozen, and associates @a node with the
+// history and the validation cache of this node.
+- (void) passStateToNode:(SGFCNode*)node
+{
+  if (_history)
+    [node setHistory:_history];
+  if (_validationCache)
+    [node setValidationCache:_validationCache];
+  if (_frozen)
+    [node freeze];
+}
+
+// Freezes @a property if this node is frozen, and associates @a property
+// with the history and the validation cache of this node.
+- (void) passStateToProperty:(SGFCProperty*)property
+{
+  if (_history)
+    [property setHistory:_history];
+  if (_validationCache)
+    [property setValidationCache:_validationCache node:_wrappedNode];
+  if (_frozen)
+    [property freeze];
+}
+
+- (NSArray*) passStateToProperties:(NSArray*)properties
+{
+  for (SGFCProperty* property in properties)
+    [self passStateToProperty:property];
+
+  return properties;
+}
+
+// Returns a function that restores the properties of the wrapped node to
+// their current state. Returns an empty function if the node is not
+// associated with a history.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForProperties
+{
+  SGFCGameHistory* history = _history;
+  if (! history)
+    return nullptr;
+
+  return [history restoreFunctionForPropertiesOfNode:_wrappedNode];
+}
+
+// Records a change of the wrapped node's properties. Notifies the validation
+// cache, then records the change in the history. @a undoFunction is the
+// function that restoreFunctionForProperties returned before the change.
+// The change is not recorded in the history if @a undoFunction is empty.
+- (void) recordPropertiesChangeWithUndoFunction:(const SGFCGameHistoryRestoreFunction&)undoFunction
+{
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (undoFunction && history)
+    redoFunction = [history restoreFunctionForPropertiesOfNode:_wrappedNode];
+
+  [self recordPropertiesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+}
+
+// Records a change of the wrapped node's properties. Notifies the validation
+// cache, then records the change in the history. @a undoFunction reverts
+// the change, @a redoFunction applies the change again. The change is not
+// recorded in the history if one of the functions is empty.
+- (void) recordPropertiesChangeWithUndoFunction:(const SGFCGameHistoryRestoreFunction&)undoFunction
+                                   redoFunction:(const SGFCGameHistoryRestoreFunction&)redoFunction
+{
+  if (_validationCache)
+    [_validationCache propertiesOfNodeDidChange:_wrappedNode];
+
+  SGFCGameHistory* history = _history;
+  if (! undoFunction || ! redoFunction || ! history)
+    return;
+
+  [history recordChangeWithUndoFunction:undoFunction
+                           redoFunction:redoFunction];
+}
+
+// Returns a function that reverts setting @a wrappedProperty on the wrapped
+// node. Must be invoked before the change is made. If the wrapped node
+// currently has a property with the same name, the function puts that
+// property back in its current position.
+- (SGFCGameHistoryRestoreFunction) undoFunctionForSettingProperty:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>&)wrappedProperty
+                                                          history:(SGFCGameHistory*)history
+{
+  auto replacedProperty = _wrappedNode->GetProperty(wrappedProperty->GetPropertyName());
+  if (replacedProperty == wrappedProperty)
+    return []() {};
+
+  auto removeSetProperty = [history removeFunctionWithProperty:wrappedProperty node:_wrappedNode];
+  if (replacedProperty == nullptr)
+    return removeSetProperty;
+
+  auto insertReplacedProperty = [history insertFunctionWithProperty:replacedProperty
+                                                              index:[self indexOfWrappedProperty:replacedProperty]
+                                                               node:_wrappedNode];
+
+  return [removeSetProperty, insertReplacedProperty]()
+  {
+    removeSetProperty();
+    insertReplacedProperty();
+  };
+}
+
+// Returns the index position of @a wrappedProperty in the wrapped node's
+// collection of properties, or NSNotFound if the wrapped node does not
+// contain @a wrappedProperty.
+- (NSUInteger) indexOfWrappedProperty:(const std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>&)wrappedProperty
+{
+  auto wrappedProperties = _wrappedNode->GetProperties();
+
+  NSUInteger numberOfProperties = wrappedProperties.size();
+  for (NSUInteger indexOfProperty = 0; indexOfProperty < numberOfProperties; indexOfProperty++)
+  {
+    if (wrappedProperties[indexOfProperty] == wrappedProperty)
+      return indexOfProperty;
+  }
+
+  return NSNotFound;
+}
+
+// Returns a function that restores the properties of the nodes that
+// writeGameInfo:() writes to, to their current state.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForGameInfoWithHistory:(SGFCGameHistory*)history
+{
+  auto wrappedRootNode = _wrappedNode->GetRoot();
+  auto wrappedGameInfoNode = _wrappedNode->GetGameInfoNode();
+
+  auto restoreRootNodeProperties = [history restoreFunctionForPropertiesOfNode:wrappedRootNode];
+  SGFCGameHistoryRestoreFunction restoreNodeProperties = []() {};
+  SGFCGameHistoryRestoreFunction restoreGameInfoNodeProperties = []() {};
+
+  if (_wrappedNode != wrappedRootNode)
+    restoreNodeProperties = [history restoreFunctionForPropertiesOfNode:_wrappedNode];
+  if (wrappedGameInfoNode && wrappedGameInfoNode != wrappedRootNode && wrappedGameInfoNode != _wrappedNode)
+    restoreGameInfoNodeProperties = [history restoreFunctionForPropertiesOfNode:wrappedGameInfoNode];
+
+  return [restoreRootNodeProperties, restoreNodeProperties, restoreGameInfoNodeProperties]()
+  {
+    restoreRootNodeProperties();
+    restoreNodeProperties();
+    restoreGameInfoNodeProperties();
+  };
 }
 
 @end
@@ -18,11 +18,14 @@
 #import "../../include/SGFCConstants.h"
 #import "../../include/SGFCProperty.h"
 #import "../interface/internal/SGFCBoardSizePropertyInternalAdditions.h"
+#import "../interface/internal/SGFCGameHistoryInternalAdditions.h"
 #import "../interface/internal/SGFCGameTypePropertyInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCPropertyInternalAdditions.h"
 #import "../interface/internal/SGFCPropertyValueInternal.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
+#import "../SGFCValidationCache.h"
 #import "../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
@@ -39,6 +42,21 @@
 @interface SGFCProperty()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty> _wrappedProperty;
+  // Must be declared explicitly because both the getter and the setter of
+  // the property are implemented manually. The array is mutable so that
+  // single values can be appended and removed in place.
+  NSMutableArray* _propertyValues;
+  // An immutable copy of _propertyValues that the propertyValues getter
+  // hands out. Reused until the next change of _propertyValues.
+  NSArray* _propertyValuesSnapshot;
+  __weak SGFCGameHistory* _history;
+  // The value of _history's undoRedoCount when _propertyValues was last
+  // synchronized with the wrapped property
+  NSUInteger _undoRedoCount;
+  SGFCValidationCache* _validationCache;
+  // The node that contains the wrapped property. Changes to the property
+  // values are reported to _validationCache as changes of this node.
+  std::weak_ptr<LibSgfcPlusPlus::ISgfcNode> _validationNode;
 }
 @end
 
@@ -93,7 +111,8 @@
 
   _wrappedProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateProperty(
     [SGFCMappingUtility fromSgfcKitPropertyType:SGFCPropertyTypeC]);
-  _propertyValues = [NSArray array];
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
+  [self replacePropertyValuesWithArray:@[]];
 
   return self;
 }
@@ -155,6 +174,7 @@
   {
     wrappedProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateProperty(
       [SGFCMappingUtility fromSgfcKitString:propertyName]);
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   }
   else
   {
@@ -163,6 +183,7 @@
       wrappedProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateProperty(
         [SGFCMappingUtility fromSgfcKitString:propertyName],
         [SGFCProperty wrappedPropertyValuesFromArray:propertyValues]);
+      SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
     }
     catch (std::invalid_argument& exception)
     {
@@ -210,9 +231,9 @@
     _wrappedProperty = wrappedProperty;
 
     if (propertyValues == nil)
-      _propertyValues = [NSArray array];
+      [self replacePropertyValuesWithArray:@[]];
     else
-      _propertyValues = propertyValues;
+      [self replacePropertyValuesWithArray:propertyValues];
   }
 
   return self;
@@ -228,7 +249,7 @@
     return nil;
 
   _wrappedProperty = wrappedProperty;
-  _propertyValues = [SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()];
+  [self replacePropertyValuesWithArray:[SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()]];
 
   return self;
 }
@@ -236,8 +257,11 @@
 - (void) dealloc
 {
   _wrappedProperty = nullptr;
+  _validationCache = nil;
+  _validationNode.reset();
   // Don't use property accessor because of nil check
   _propertyValues = nil;
+  _propertyValuesSnapshot = nil;
 }
 
 #pragma mark - Public API
@@ -273,11 +297,31 @@
   return [SGFCMappingUtility toSgfcKitBoolean:_wrappedProperty->HasPropertyValues()];
 }
 
+- (NSArray*) propertyValues
+{
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
+  if (_propertyValuesSnapshot)
+  {
+    // Reuse the copy that was made after the last change
+  }
+  else
+  {
+    _propertyValuesSnapshot = [_propertyValues copy];
+  }
+
+  return _propertyValuesSnapshot;
+}
+
 - (void) setPropertyValues:(NSArray*)propertyValues
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"property"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:propertyValues
                                                  invalidArgumentName:@"propertyValues"];
 
+  auto undoFunction = [self restoreFunctionForValues];
+
   try
   {
     _wrappedProperty->SetPropertyValues(
@@ -288,54 +332,172 @@
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
-  _propertyValues = propertyValues;
+  [self recordValuesChangeWithUndoFunction:undoFunction];
+
+  [self replacePropertyValuesWithArray:propertyValues];
+  _undoRedoCount = [_history undoRedoCount];
 }
 
 - (void) appendPropertyValue:(id<SGFCPropertyValue>)propertyValue
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"property"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:propertyValue
                                                  invalidArgumentName:@"propertyValue"];
 
+  auto wrappedPropertyValue = [SGFCProperty wrappedPropertyValueFromObject:propertyValue];
+
+  // _propertyValues is patched below, so it must be up-to-date before the
+  // wrapped property is modified
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
   try
   {
-    _wrappedProperty->AppendPropertyValue([SGFCProperty wrappedPropertyValueFromObject:propertyValue]);
+    _wrappedProperty->AppendPropertyValue(wrappedPropertyValue);
   }
   catch (std::invalid_argument& exception)
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
-  _propertyValues = [SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()];
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>> appendedPropertyValues = { wrappedPropertyValue };
+  [self recordAppendOfWrappedPropertyValues:appendedPropertyValues];
+
+  // The wrapped property now contains the wrapped value of propertyValue as
+  // its last value, so we can reuse propertyValue instead of re-wrapping
+  // all values
+  [_propertyValues addObject:propertyValue];
+  _propertyValuesSnapshot = nil;
+}
+
+- (void) appendPropertyValues:(NSArray*)propertyValues
+{
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"property"];
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:propertyValues
+                                                 invalidArgumentName:@"propertyValues"];
+
+  if (propertyValues.count == 0)
+    return;
+
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
+  auto wrappedPropertyValues = _wrappedProperty->GetPropertyValues();
+  auto wrappedPropertyValuesToAppend = [SGFCProperty wrappedPropertyValuesFromArray:propertyValues];
+  wrappedPropertyValues.insert(
+    wrappedPropertyValues.end(),
+    wrappedPropertyValuesToAppend.begin(),
+    wrappedPropertyValuesToAppend.end());
+
+  try
+  {
+    // SetPropertyValues() also checks for duplicates, both among the new
+    // values and between the new and the existing values
+    _wrappedProperty->SetPropertyValues(wrappedPropertyValues);
+  }
+  catch (std::invalid_argument& exception)
+  {
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
+  }
+
+  [self recordAppendOfWrappedPropertyValues:wrappedPropertyValuesToAppend];
+
+  [_propertyValues addObjectsFromArray:propertyValues];
+  _propertyValuesSnapshot = nil;
 }
 
 - (void) removePropertyValue:(id<SGFCPropertyValue>)propertyValue
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"property"];
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:propertyValue
                                                  invalidArgumentName:@"propertyValue"];
 
+  auto wrappedPropertyValue = [SGFCProperty wrappedPropertyValueFromObject:propertyValue];
+
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
+  // The object in the collection is not necessarily the same object as
+  // propertyValue, it may be a different object that wraps the same value.
+  NSUInteger indexOfPropertyValue = NSNotFound;
+  NSUInteger indexOfPropertyValueObject = 0;
+  for (id propertyValueObject in _propertyValues)
+  {
+    // TODO We silently assume that the object adopts SGFCPropertyValueInternal.
+    // Find a better way how to ensure that this is actually the case.
+    if ([propertyValueObject wrappedPropertyValue] == wrappedPropertyValue)
+    {
+      indexOfPropertyValue = indexOfPropertyValueObject;
+      break;
+    }
+
+    indexOfPropertyValueObject++;
+  }
+
+  // Record only the delta if possible, not the entire collection of values
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (history && indexOfPropertyValue != NSNotFound)
+  {
+    undoFunction = [history insertFunctionWithPropertyValue:wrappedPropertyValue
+                                                      index:indexOfPropertyValue
+                                                   property:_wrappedProperty];
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>> removedPropertyValues = { wrappedPropertyValue };
+    redoFunction = [history removeFunctionWithPropertyValues:removedPropertyValues
+                                                    property:_wrappedProperty];
+  }
+  else
+  {
+    undoFunction = [self restoreFunctionForValues];
+  }
+
   try
   {
-    _wrappedProperty->RemovePropertyValue([SGFCProperty wrappedPropertyValueFromObject:propertyValue]);
+    _wrappedProperty->RemovePropertyValue(wrappedPropertyValue);
   }
   catch (std::invalid_argument& exception)
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
 
-  _propertyValues = [SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()];
+  if (redoFunction)
+    [self recordValuesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+  else
+    [self recordValuesChangeWithUndoFunction:undoFunction];
+
+  // Remove only the one affected object instead of re-wrapping all values
+  if (indexOfPropertyValue != NSNotFound)
+  {
+    [_propertyValues removeObjectAtIndex:indexOfPropertyValue];
+    _propertyValuesSnapshot = nil;
+  }
+  else
+  {
+    // We only get here if _propertyValues is out of sync with the wrapped
+    // property
+    [self replacePropertyValuesWithArray:[SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()]];
+  }
 }
 
 - (void) removeAllPropertyValues
 {
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:_frozen
+                                                    objectName:@"property"];
+
+  auto undoFunction = [self restoreFunctionForValues];
   _wrappedProperty->RemoveAllPropertyValues();
+  [self recordValuesChangeWithUndoFunction:undoFunction];
 
-  _propertyValues = [NSArray array];
+  [self replacePropertyValuesWithArray:@[]];
 }
 
 - (id<SGFCPropertyValue>) propertyValue
 {
   auto wrappedPropertyValue = _wrappedProperty->GetPropertyValue();
 
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
   for (id propertyValueObject in _propertyValues)
   {
     // TODO We silently assume that the object adopts SGFCPropertyValueInternal.
@@ -370,7 +532,7 @@
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"wrappedProperty\" is nullptr"];
 
   _wrappedProperty = wrappedProperty;
-  _propertyValues = [SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()];
+  [self replacePropertyValuesWithArray:[SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()]];
 }
 
 - (void) setWrappedProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)wrappedProperty
@@ -382,11 +544,126 @@
                                                  invalidArgumentName:@"propertyValues"];
 
   _wrappedProperty = wrappedProperty;
-  _propertyValues = propertyValues;
+  [self replacePropertyValuesWithArray:propertyValues];
+}
+
+- (void) setHistory:(SGFCGameHistory*)history
+{
+  if (history != _history)
+  {
+    _history = history;
+    _undoRedoCount = [history undoRedoCount];
+  }
+}
+
+- (void) setValidationCache:(SGFCValidationCache*)validationCache
+                       node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node
+{
+  _validationCache = validationCache;
+  _validationNode = node;
+}
+
+- (void) freeze
+{
+  if (_frozen)
+    return;
+
+  [self updatePropertyValuesIfUndoOrRedoOccurred];
+
+  // Make the copy now so that concurrent readers of the frozen property
+  // never have to create it
+  _propertyValuesSnapshot = [_propertyValues copy];
+
+  _frozen = YES;
 }
 
 #pragma mark - Private API
 
+// Replaces the content of _propertyValues with the objects in
+// @a propertyValues, and discards the copy that was handed out.
+- (void) replacePropertyValuesWithArray:(NSArray*)propertyValues
+{
+  _propertyValues = [NSMutableArray arrayWithArray:propertyValues];
+  _propertyValuesSnapshot = nil;
+}
+
+// Re-wraps the values of the wrapped property if _history has reverted or
+// re-applied a version since _propertyValues was last synchronized. The
+// wrapped property might have been modified by that.
+- (void) updatePropertyValuesIfUndoOrRedoOccurred
+{
+  if (_frozen)
+    return;
+
+  NSUInteger undoRedoCount = [_history undoRedoCount];
+  if (_undoRedoCount == undoRedoCount)
+    return;
+
+  [self replacePropertyValuesWithArray:[SGFCWrappingUtility wrapPropertyValues:_wrappedProperty->GetPropertyValues()]];
+  _undoRedoCount = undoRedoCount;
+}
+
+// Returns a function that restores the values of the wrapped property to
+// their current state. Returns an empty function if the property is not
+// associated with a history.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForValues
+{
+  SGFCGameHistory* history = _history;
+  if (! history)
+    return nullptr;
+
+  return [history restoreFunctionForValuesOfProperty:_wrappedProperty];
+}
+
+// Records a change of the wrapped property's values. Notifies the
+// validation cache, then records the change in the history. @a undoFunction
+// is the function that restoreFunctionForValues returned before the change.
+// The change is not recorded in the history if @a undoFunction is empty.
+- (void) recordValuesChangeWithUndoFunction:(const SGFCGameHistoryRestoreFunction&)undoFunction
+{
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (undoFunction && history)
+    redoFunction = [history restoreFunctionForValuesOfProperty:_wrappedProperty];
+
+  [self recordValuesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+}
+
+// Records a change of the wrapped property's values. Notifies the
+// validation cache, then records the change in the history. @a undoFunction
+// reverts the change, @a redoFunction applies the change again. The change
+// is not recorded in the history if one of the functions is empty.
+- (void) recordValuesChangeWithUndoFunction:(const SGFCGameHistoryRestoreFunction&)undoFunction
+                               redoFunction:(const SGFCGameHistoryRestoreFunction&)redoFunction
+{
+  if (_validationCache)
+    [_validationCache propertiesOfNodeDidChange:_validationNode.lock()];
+
+  SGFCGameHistory* history = _history;
+  if (! undoFunction || ! redoFunction || ! history)
+    return;
+
+  [history recordChangeWithUndoFunction:undoFunction
+                           redoFunction:redoFunction];
+}
+
+// Records that @a wrappedPropertyValues were appended to the values of the
+// wrapped property. Only the delta is recorded, not the entire collection
+// of values.
+- (void) recordAppendOfWrappedPropertyValues:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>&)wrappedPropertyValues
+{
+  SGFCGameHistory* history = _history;
+  SGFCGameHistoryRestoreFunction undoFunction;
+  SGFCGameHistoryRestoreFunction redoFunction;
+  if (history)
+  {
+    undoFunction = [history removeFunctionWithPropertyValues:wrappedPropertyValues property:_wrappedProperty];
+    redoFunction = [history appendFunctionWithPropertyValues:wrappedPropertyValues property:_wrappedProperty];
+  }
+
+  [self recordValuesChangeWithUndoFunction:undoFunction redoFunction:redoFunction];
+}
+
 + (NSString*) propertyNameForPropertyType:(SGFCPropertyType)propertyType
 {
   if (propertyType == SGFCPropertyTypeUnknown)
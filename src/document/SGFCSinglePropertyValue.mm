@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../../include/SGFCSinglePropertyValue.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
@@ -62,6 +63,7 @@
 
   _wrappedSinglePropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateCustomPropertyValue(
     [SGFCMappingUtility fromSgfcKitString:rawValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   self.composedValue = false;
 
   return self;
@@ -16,13 +16,28 @@
 
 // Project includes
 #import "../../include/SGFCTreeBuilder.h"
+#import "../interface/internal/SGFCGameHistoryInternalAdditions.h"
 #import "../interface/internal/SGFCGameInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCNodeInternalAdditions.h"
 #import "../interface/internal/SGFCTreeBuilderInternalAdditions.h"
 #import "../SGFCExceptionUtility.h"
+#import "../SGFCMappingUtility.h"
+#import "../SGFCValidationCache.h"
+#import "../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcPropertyFactory.h>
+#import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
 #import <libsgfcplusplus/ISgfcTreeBuilder.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// C++ Standard Library includes
+#import <functional>
+#import <string>
+#import <vector>
 
 #pragma mark - Class extension
 
@@ -68,6 +83,14 @@
 - (void) setFirstChild:(SGFCNode*)child
                 ofNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:child];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedNodeOrNullPtr:node],
+    [self wrappedParentOrNullPtr:child] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->SetFirstChild(
@@ -78,11 +101,23 @@
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:child];
 }
 
 - (void) appendChild:(SGFCNode*)child
               toNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:child];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedNodeOrNullPtr:node],
+    [self wrappedParentOrNullPtr:child] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->AppendChild(
@@ -93,12 +128,24 @@
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:child];
 }
 
 - (void) insertChild:(SGFCNode*)child
               toNode:(SGFCNode*)node
 beforeReferenceChild:(SGFCNode*)referenceChild
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:child];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedNodeOrNullPtr:node],
+    [self wrappedParentOrNullPtr:child] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->InsertChild(
@@ -110,11 +157,22 @@ beforeReferenceChild:(SGFCNode*)referenceChild
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:child];
 }
 
 - (void) removeChild:(SGFCNode*)child
             fromNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:child];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedNodeOrNullPtr:node] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->RemoveChild(
@@ -125,12 +183,24 @@ beforeReferenceChild:(SGFCNode*)referenceChild
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
 }
 
 - (void) replaceChild:(SGFCNode*)oldChild
          withNewChild:(SGFCNode*)newChild
                inNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:oldChild];
+  [self raiseIfGameOrNodeIsFrozen:newChild];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedNodeOrNullPtr:node],
+    [self wrappedParentOrNullPtr:newChild] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->ReplaceChild(
@@ -142,11 +212,23 @@ beforeReferenceChild:(SGFCNode*)referenceChild
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:newChild];
 }
 
 - (void) setNextSibling:(SGFCNode*)nextSibling
                  ofNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:nextSibling];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedParentOrNullPtr:node],
+    [self wrappedParentOrNullPtr:nextSibling] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->SetNextSibling(
@@ -157,11 +239,23 @@ beforeReferenceChild:(SGFCNode*)referenceChild
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:nextSibling];
 }
 
 - (void) setParent:(SGFCNode*)parent
             ofNode:(SGFCNode*)node
 {
+  [self raiseIfGameOrNodeIsFrozen:node];
+  [self raiseIfGameOrNodeIsFrozen:parent];
+
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = {
+    [self wrappedParentOrNullPtr:node],
+    [self wrappedNodeOrNullPtr:parent] };
+  auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
   try
   {
     _wrappedTreeBuilder->SetParent(
@@ -172,10 +266,175 @@ beforeReferenceChild:(SGFCNode*)referenceChild
   {
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
   }
+
+  [self recordChildrenChangeOfNodes:affectedNodes
+                        undoFunction:undoFunction];
+  [self associateNodeWithGame:node];
+}
+
+- (SGFCNode*) appendGoMoves:(const SGFCPackedGoMove*)goMoves
+            numberOfGoMoves:(NSUInteger)numberOfGoMoves
+                     toNode:(SGFCNode*)node
+{
+  if (goMoves == NULL && numberOfGoMoves > 0)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"goMoves\" is NULL"];
+
+  return [self appendGoMovesToNode:node
+                  withMoveProvider:[goMoves, numberOfGoMoves](NSUInteger moveIndex, SGFCPackedGoMove& goMove) -> bool
+  {
+    if (moveIndex >= numberOfGoMoves)
+      return false;
+
+    goMove = goMoves[moveIndex];
+    return true;
+  }];
+}
+
+- (SGFCNode*) appendGoMovesToNode:(SGFCNode*)node
+                    withGenerator:(SGFCPackedGoMoveGenerator)generator
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:generator
+                                                 invalidArgumentName:@"generator"];
+
+  return [self appendGoMovesToNode:node
+                  withMoveProvider:[generator](NSUInteger moveIndex, SGFCPackedGoMove& goMove) -> bool
+  {
+    return generator(moveIndex, &goMove) == YES;
+  }];
 }
 
 #pragma mark - Private API
 
+- (SGFCNode*) appendGoMovesToNode:(SGFCNode*)node
+                 withMoveProvider:(const std::function<bool(NSUInteger, SGFCPackedGoMove&)>&)moveProvider
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:node
+                                                 invalidArgumentName:@"node"];
+  [self raiseIfGameOrNodeIsFrozen:node];
+
+  auto wrappedGame = [self.game wrappedGame];
+  if (wrappedGame == nullptr || wrappedGame->GetGameType() != LibSgfcPlusPlus::SgfcGameType::Go)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Game is not a Go game"];
+
+  auto boardSize = wrappedGame->GetBoardSize();
+  if (! boardSize.IsValid(LibSgfcPlusPlus::SgfcGameType::Go))
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Game has an invalid board size"];
+
+  auto propertyFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory();
+  auto colorBlack = [SGFCMappingUtility fromSgfcKitColor:SGFCColorBlack];
+  auto colorWhite = [SGFCMappingUtility fromSgfcKitColor:SGFCColorWhite];
+
+  // The new nodes are linked to each other while they are still detached
+  // from the game tree. The game tree is modified only after all moves have
+  // been successfully converted.
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> firstNewNode;
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcNode> lastNewNode;
+
+  try
+  {
+    NSUInteger moveIndex = 0;
+    SGFCPackedGoMove goMove;
+    while (moveProvider(moveIndex, goMove))
+    {
+      if (goMove.Color != SGFCColorBlack && goMove.Color != SGFCColorWhite)
+      {
+        NSString* reason = [NSString stringWithFormat:@"Move at index %lu has an invalid color", static_cast<unsigned long>(moveIndex)];
+        [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:reason];
+      }
+
+      bool isBlackMove = (goMove.Color == SGFCColorBlack);
+      LibSgfcPlusPlus::SgfcColor color = isBlackMove ? colorBlack : colorWhite;
+      LibSgfcPlusPlus::SgfcPropertyType propertyType = isBlackMove ? LibSgfcPlusPlus::SgfcPropertyType::B : LibSgfcPlusPlus::SgfcPropertyType::W;
+
+      std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue> propertyValue;
+      if (goMove.IsPassMove)
+      {
+        propertyValue = propertyValueFactory->CreateGoMovePropertyValue(color);
+      }
+      else
+      {
+        propertyValue = propertyValueFactory->CreateGoMovePropertyValue(
+          [self sgfNotationForGoMove:goMove moveIndex:moveIndex boardSize:boardSize],
+          boardSize,
+          color);
+      }
+
+      auto newNode = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateNode();
+      newNode->SetProperties({ propertyFactory->CreateProperty(propertyType, propertyValue) });
+      // The property value, the node and the property
+      SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount, 3);
+
+      if (firstNewNode == nullptr)
+        firstNewNode = newNode;
+      else
+        _wrappedTreeBuilder->SetFirstChild(lastNewNode, newNode);
+      lastNewNode = newNode;
+
+      moveIndex++;
+    }
+
+    if (firstNewNode == nullptr)
+      return node;
+
+    std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>> affectedNodes = { [node wrappedNode] };
+    auto undoFunction = [self restoreFunctionForChildrenOfNodes:affectedNodes];
+
+    _wrappedTreeBuilder->AppendChild([node wrappedNode], firstNewNode);
+
+    [self recordChildrenChangeOfNodes:affectedNodes
+                         undoFunction:undoFunction];
+  }
+  catch (std::invalid_argument& exception)
+  {
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithCStringReason:exception.what()];
+  }
+
+  SGFCNode* lastNewNodeWrapper = [SGFCWrappingUtility wrapNode:lastNewNode];
+  [self associateNodeWithGame:lastNewNodeWrapper];
+
+  return lastNewNodeWrapper;
+}
+
+- (std::string) sgfNotationForGoMove:(const SGFCPackedGoMove&)goMove
+                           moveIndex:(NSUInteger)moveIndex
+                           boardSize:(const LibSgfcPlusPlus::SgfcBoardSize&)boardSize
+{
+  // The SGF notation uses the letters a-z for positions 1-26, and A-Z
+  // for positions 27-52. SGFCBoardSizeMaximumGo is 52.
+  if (goMove.XPosition < 1 || goMove.XPosition > static_cast<SGFCGoPointAxisPosition>(boardSize.Columns) ||
+      goMove.YPosition < 1 || goMove.YPosition > static_cast<SGFCGoPointAxisPosition>(boardSize.Rows))
+  {
+    NSString* reason = [NSString stringWithFormat:@"Move at index %lu has a position that is not on the board", static_cast<unsigned long>(moveIndex)];
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:reason];
+  }
+
+  std::string sgfNotation(2, ' ');
+  sgfNotation[0] = [self sgfNotationForAxisPosition:goMove.XPosition];
+  sgfNotation[1] = [self sgfNotationForAxisPosition:goMove.YPosition];
+
+  return sgfNotation;
+}
+
+- (char) sgfNotationForAxisPosition:(SGFCGoPointAxisPosition)axisPosition
+{
+  if (axisPosition <= 26)
+    return static_cast<char>('a' + axisPosition - 1);
+  else
+    return static_cast<char>('A' + axisPosition - 27);
+}
+
+// Raises SGFCInvalidOperationException if the game that the tree builder
+// belongs to is frozen, or if @a node is frozen. Does nothing if @a node is
+// nil and the game is not frozen.
+- (void) raiseIfGameOrNodeIsFrozen:(SGFCNode*)node
+{
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:self.game.isFrozen
+                                                    objectName:@"game"];
+  [SGFCExceptionUtility raiseInvalidOperationExceptionIfFrozen:node.isFrozen
+                                                    objectName:@"node"];
+}
+
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) wrappedNodeOrNullPtr:(SGFCNode*)node
 {
   if (node)
@@ -184,4 +443,64 @@ beforeReferenceChild:(SGFCNode*)referenceChild
     return nullptr;
 }
 
+- (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) wrappedParentOrNullPtr:(SGFCNode*)node
+{
+  if (node)
+    return [node wrappedNode]->GetParent();
+  else
+    return nullptr;
+}
+
+// Returns a function that restores the children of all nodes in
+// @a affectedNodes to their current state. Returns an empty function if the
+// game does not record a history. @a affectedNodes may contain nullptr
+// elements.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForChildrenOfNodes:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>>&)affectedNodes
+{
+  SGFCGameHistory* history = self.game.history;
+  if (! history)
+    return nullptr;
+
+  std::vector<SGFCGameHistoryRestoreFunction> restoreFunctions;
+  for (const auto& affectedNode : affectedNodes)
+    restoreFunctions.push_back([history restoreFunctionForChildrenOfNode:affectedNode]);
+
+  return [restoreFunctions]()
+  {
+    for (const auto& restoreFunction : restoreFunctions)
+      restoreFunction();
+  };
+}
+
+// Records a change of the children of the nodes in @a affectedNodes.
+// Notifies the game's validation cache, then records the change in the
+// game's history. @a undoFunction is the function that
+// restoreFunctionForChildrenOfNodes:() returned before the change. The
+// change is not recorded in the history if @a undoFunction is empty.
+- (void) recordChildrenChangeOfNodes:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>>&)affectedNodes
+                        undoFunction:(const SGFCGameHistoryRestoreFunction&)undoFunction
+{
+  SGFCValidationCache* validationCache = [self.game validationCache];
+  for (const auto& affectedNode : affectedNodes)
+    [validationCache childrenOfNodeDidChange:affectedNode];
+
+  SGFCGameHistory* history = self.game.history;
+  if (! undoFunction || ! history)
+    return;
+
+  [history recordChangeWithUndoFunction:undoFunction
+                           redoFunction:[self restoreFunctionForChildrenOfNodes:affectedNodes]];
+}
+
+// Associates @a node, which has just become part of the game tree, with
+// the game's history and the game's validation cache so that property
+// changes made through @a node are recorded. Does nothing if @a node is nil.
+- (void) associateNodeWithGame:(SGFCNode*)node
+{
+  SGFCGameHistory* history = self.game.history;
+  if (history)
+    [node setHistory:history];
+  [node setValidationCache:[self.game validationCache]];
+}
+
 @end
@@ -17,6 +17,7 @@
 // Project includes
 #import "../../../include/SGFCBoardSizeProperty.h"
 #import "../../interface/internal/SGFCComposedPropertyValueInternalAdditions.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCNumberPropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCPropertyInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -64,6 +65,7 @@
     return nil;
 
   _wrappedBoardSizeProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateBoardSizeProperty();
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Overwrite the useless wrapped object that the superclass
   // initializer created with the real wrapped object.
@@ -79,6 +81,7 @@
 
   auto wrappedBoardSizeProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateBoardSizeProperty(
     [numberPropertyValue wrappedNumberPropertyValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   self = [self initWithWrappedBoardSizeProperty:wrappedBoardSizeProperty
                                  propertyValues:[NSArray arrayWithObject:numberPropertyValue]];
@@ -95,6 +98,7 @@
 
   auto wrappedBoardSizeProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateBoardSizeProperty(
     [composedPropertyValue wrappedComposedPropertyValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   self = [self initWithWrappedBoardSizeProperty:_wrappedBoardSizeProperty
                                  propertyValues:[NSArray arrayWithObject:composedPropertyValue]];
@@ -17,6 +17,7 @@
 // Project includes
 #import "../../../include/SGFCGameTypeProperty.h"
 #import "../../interface/internal/SGFCComposedPropertyValueInternalAdditions.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCNumberPropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCPropertyInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -59,6 +60,7 @@
     return nil;
 
   _wrappedGameTypeProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateGameTypeProperty();
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Overwrite the useless wrapped object that the superclass
   // initializer created with the real wrapped object.
@@ -74,6 +76,7 @@
 
   auto wrappedGameTypeProperty = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyFactory()->CreateGameTypeProperty(
     [numberPropertyValue wrappedNumberPropertyValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   self = [self initWithWrappedGameTypeProperty:wrappedGameTypeProperty
                                 propertyValues:[NSArray arrayWithObject:numberPropertyValue]];
@@ -18,6 +18,7 @@
 #import "../../../include/SGFCConstants.h"
 #import "../../../include/SGFCDoublePropertyValue.h"
 #import "../../interface/internal/SGFCDoublePropertyValueInternalAdditions.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
 #import "../../SGFCMappingUtility.h"
@@ -70,6 +71,7 @@
   // initializer has a problem.
   auto wrappedDoublePropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateDoublePropertyValue(
     [SGFCMappingUtility fromSgfcKitDouble:doubleValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCSinglePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
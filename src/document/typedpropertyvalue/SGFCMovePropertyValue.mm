@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../../../include/SGFCMovePropertyValue.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCMovePropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -61,6 +62,7 @@
   // initializer has a problem.
   auto wrappedMovePropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateMovePropertyValue(
     [SGFCMappingUtility fromSgfcKitMove:moveValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCSinglePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
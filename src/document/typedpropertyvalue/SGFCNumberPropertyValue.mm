@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../../../include/SGFCNumberPropertyValue.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCNumberPropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -68,6 +69,7 @@
   // initializer has a problem.
   auto wrappedNumberPropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateNumberPropertyValue(
     [SGFCMappingUtility fromSgfcKitNumber:numberValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCSinglePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
@@ -92,6 +94,7 @@
 
   auto wrappedNumberPropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateGameTypePropertyValue(
     [SGFCMappingUtility fromSgfcKitGameType:gameType]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   return [self initWithWrappedNumberPropertyValue:wrappedNumberPropertyValue];
 }
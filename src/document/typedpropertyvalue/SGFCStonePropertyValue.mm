@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../../../include/SGFCStonePropertyValue.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCStonePropertyValueInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -61,6 +62,7 @@
   // initializer has a problem.
   auto wrappedStonePropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateStonePropertyValue(
     [SGFCMappingUtility fromSgfcKitStone:stoneValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCSinglePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
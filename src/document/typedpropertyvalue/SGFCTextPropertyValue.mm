@@ -16,6 +16,7 @@
 
 // Project includes
 #import "../../../include/SGFCTextPropertyValue.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../interface/internal/SGFCSinglePropertyValueInternalAdditions.h"
 #import "../../interface/internal/SGFCTextPropertyValueInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -61,6 +62,7 @@
   // initializer has a problem.
   auto wrappedTextPropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateTextPropertyValue(
     [SGFCMappingUtility fromSgfcKitText:textValue]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCSinglePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
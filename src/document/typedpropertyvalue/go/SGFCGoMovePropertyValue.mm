@@ -18,21 +18,29 @@
 #import "../../../../include/SGFCConstants.h"
 #import "../../../../include/SGFCGoMovePropertyValue.h"
 #import "../../../interface/internal/SGFCGoMovePropertyValueInternalAdditions.h"
+#import "../../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../../interface/internal/SGFCMovePropertyValueInternalAdditions.h"
 #import "../../../SGFCExceptionUtility.h"
 #import "../../../SGFCMappingUtility.h"
 #import "../../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGoMove.h>
 #import <libsgfcplusplus/ISgfcGoMovePropertyValue.h>
+#import <libsgfcplusplus/ISgfcGoPoint.h>
+#import <libsgfcplusplus/ISgfcGoStone.h>
 #import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <mutex>
+
 #pragma mark - Class extension
 
 @interface SGFCGoMovePropertyValue()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcGoMovePropertyValue> _wrappedGoMovePropertyValue;
+  std::once_flag _goMoveOnceFlag;
 }
 
 @property(nonatomic, strong, readwrite) SGFCGoMove* goMove;
@@ -81,7 +89,8 @@
     [SGFCMappingUtility fromSgfcKitMove:moveValue],
     [SGFCMappingUtility fromSgfcKitBoardSize:boardSize],
     [SGFCMappingUtility fromSgfcKitColor:color]);
-  self.goMove = [SGFCWrappingUtility wrapGoMove:_wrappedGoMovePropertyValue->GetGoMove()];
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
+  self.goMove = nil;
 
   [self setWrappedMovePropertyValue:_wrappedGoMovePropertyValue];
 
@@ -95,6 +104,7 @@
   // initializer has a problem.
   auto wrappedGoMovePropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateGoMovePropertyValue(
     [SGFCMappingUtility fromSgfcKitColor:color]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCMovePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
@@ -104,7 +114,6 @@
     return nil;
 
   _wrappedGoMovePropertyValue = wrappedGoMovePropertyValue;
-  self.goMove = [SGFCWrappingUtility wrapGoMove:_wrappedGoMovePropertyValue->GetGoMove()];
 
   // Overwrite the useless wrapped object that the superclass
   // initializer created with the real wrapped object.
@@ -123,8 +132,8 @@
     return nil;
 
   _wrappedGoMovePropertyValue = wrappedGoMovePropertyValue;
+  self.goMove = nil;
 
-  self.goMove = [SGFCWrappingUtility wrapGoMove:_wrappedGoMovePropertyValue->GetGoMove()];
   [self setWrappedMovePropertyValue:_wrappedGoMovePropertyValue];
 
   return self;
@@ -136,6 +145,52 @@
   self.goMove = nil;
 }
 
+#pragma mark - Public API
+
+- (SGFCGoMove*) goMove
+{
+  // The SGFCGoMove object is created on demand when it is first accessed.
+  // Most clients only need the scalar accessors below. std::call_once makes
+  // the first access safe if several threads read a frozen document
+  // concurrently.
+  std::call_once(_goMoveOnceFlag, [&]()
+  {
+    _goMove = [SGFCWrappingUtility wrapGoMove:_wrappedGoMovePropertyValue->GetGoMove()];
+  });
+
+  return _goMove;
+}
+
+- (BOOL) isPassMove
+{
+  return [SGFCMappingUtility toSgfcKitBoolean:_wrappedGoMovePropertyValue->GetGoMove()->IsPassMove()];
+}
+
+- (SGFCColor) playerColor
+{
+  return [SGFCMappingUtility toSgfcKitColor:_wrappedGoMovePropertyValue->GetGoMove()->GetPlayerColor()];
+}
+
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  auto wrappedStone = _wrappedGoMovePropertyValue->GetGoMove()->GetStone();
+  if (wrappedStone == nullptr)
+    return 0;
+
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:wrappedStone->GetLocation()->GetXPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  auto wrappedStone = _wrappedGoMovePropertyValue->GetGoMove()->GetStone();
+  if (wrappedStone == nullptr)
+    return 0;
+
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:wrappedStone->GetLocation()->GetYPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
 #pragma mark - SGFCMovePropertyValue overrides
 
 - (SGFCGoMovePropertyValue*) toGoMoveValue
@@ -18,21 +18,27 @@
 #import "../../../../include/SGFCConstants.h"
 #import "../../../../include/SGFCGoPointPropertyValue.h"
 #import "../../../interface/internal/SGFCGoPointPropertyValueInternalAdditions.h"
+#import "../../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../../interface/internal/SGFCPointPropertyValueInternalAdditions.h"
 #import "../../../SGFCExceptionUtility.h"
 #import "../../../SGFCMappingUtility.h"
 #import "../../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGoPoint.h>
 #import <libsgfcplusplus/ISgfcGoPointPropertyValue.h>
 #import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <mutex>
+
 #pragma mark - Class extension
 
 @interface SGFCGoPointPropertyValue()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcGoPointPropertyValue> _wrappedGoPointPropertyValue;
+  std::once_flag _goPointOnceFlag;
 }
 
 @property(nonatomic, strong, readwrite) SGFCGoPoint* goPoint;
@@ -72,6 +78,7 @@
   auto wrappedGoPointPropertyValue = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateGoPointPropertyValue(
     [SGFCMappingUtility fromSgfcKitPoint:pointValue],
     [SGFCMappingUtility fromSgfcKitBoardSize:boardSize]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCPointPropertyValue).
   // The superclass creates a useless wrapped object which we are going to
@@ -81,7 +88,6 @@
     return nil;
 
   _wrappedGoPointPropertyValue = wrappedGoPointPropertyValue;
-  self.goPoint = [SGFCWrappingUtility wrapGoPoint:_wrappedGoPointPropertyValue->GetGoPoint()];
 
   // Overwrite the useless wrapped object that the superclass
   // initializer created with the real wrapped object.
@@ -101,12 +107,8 @@
     return nil;
 
   _wrappedGoPointPropertyValue = wrappedGoPointPropertyValue;
+  self.goPoint = nil;
 
-  auto wrappedGoPoint = _wrappedGoPointPropertyValue->GetGoPoint();
-  if (wrappedGoPoint)
-    self.goPoint = [SGFCWrappingUtility wrapGoPoint:_wrappedGoPointPropertyValue->GetGoPoint()];
-  else
-    self.goPoint = nil;
   [self setWrappedPointPropertyValue:_wrappedGoPointPropertyValue];
 
   return self;
@@ -118,6 +120,44 @@
   self.goPoint = nil;
 }
 
+#pragma mark - Public API
+
+- (SGFCGoPoint*) goPoint
+{
+  // The SGFCGoPoint object is created on demand when it is first accessed.
+  // Most clients only need the scalar accessors below. std::call_once makes
+  // the first access safe if several threads read a frozen document
+  // concurrently.
+  std::call_once(_goPointOnceFlag, [&]()
+  {
+    auto wrappedGoPoint = _wrappedGoPointPropertyValue->GetGoPoint();
+    if (wrappedGoPoint != nullptr)
+      _goPoint = [SGFCWrappingUtility wrapGoPoint:wrappedGoPoint];
+  });
+
+  return _goPoint;
+}
+
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  auto wrappedGoPoint = _wrappedGoPointPropertyValue->GetGoPoint();
+  if (wrappedGoPoint == nullptr)
+    return 0;
+
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:wrappedGoPoint->GetXPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  auto wrappedGoPoint = _wrappedGoPointPropertyValue->GetGoPoint();
+  if (wrappedGoPoint == nullptr)
+    return 0;
+
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:wrappedGoPoint->GetYPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
 #pragma mark - SGFCPointPropertyValue overrides
 
 - (SGFCGoPointPropertyValue*) toGoPointValue
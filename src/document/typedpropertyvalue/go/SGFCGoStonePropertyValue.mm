@@ -18,21 +18,28 @@
 #import "../../../../include/SGFCConstants.h"
 #import "../../../../include/SGFCGoStonePropertyValue.h"
 #import "../../../interface/internal/SGFCGoStonePropertyValueInternalAdditions.h"
+#import "../../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../../interface/internal/SGFCStonePropertyValueInternalAdditions.h"
 #import "../../../SGFCExceptionUtility.h"
 #import "../../../SGFCMappingUtility.h"
 #import "../../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcGoPoint.h>
+#import <libsgfcplusplus/ISgfcGoStone.h>
 #import <libsgfcplusplus/ISgfcGoStonePropertyValue.h>
 #import <libsgfcplusplus/ISgfcPropertyValueFactory.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <mutex>
+
 #pragma mark - Class extension
 
 @interface SGFCGoStonePropertyValue()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcGoStonePropertyValue> _wrappedGoStonePropertyValue;
+  std::once_flag _goStoneOnceFlag;
 }
 
 @property(nonatomic, strong, readwrite) SGFCGoStone* goStone;
@@ -77,6 +84,7 @@
     [SGFCMappingUtility fromSgfcKitStone:stoneValue],
     [SGFCMappingUtility fromSgfcKitBoardSize:boardSize],
     [SGFCMappingUtility fromSgfcKitColor:color]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // Call designated initializer of superclass (SGFCStonePropertyValue).
   // The superclass creates a useless wrapped object which we are going to
@@ -86,7 +94,6 @@
     return nil;
 
   _wrappedGoStonePropertyValue = wrappedGoStonePropertyValue;
-  self.goStone = [SGFCWrappingUtility wrapGoStone:_wrappedGoStonePropertyValue->GetGoStone()];
 
   // Overwrite the useless wrapped object that the superclass
   // initializer created with the real wrapped object.
@@ -107,8 +114,8 @@
     return nil;
 
   _wrappedGoStonePropertyValue = wrappedGoStonePropertyValue;
+  self.goStone = nil;
 
-  self.goStone = [SGFCWrappingUtility wrapGoStone:_wrappedGoStonePropertyValue->GetGoStone()];
   [self setWrappedStonePropertyValue:_wrappedGoStonePropertyValue];
 
   return self;
@@ -120,6 +127,39 @@
   self.goStone = nil;
 }
 
+#pragma mark - Public API
+
+- (SGFCGoStone*) goStone
+{
+  // The SGFCGoStone object is created on demand when it is first accessed.
+  // Most clients only need the scalar accessors below. std::call_once makes
+  // the first access safe if several threads read a frozen document
+  // concurrently.
+  std::call_once(_goStoneOnceFlag, [&]()
+  {
+    _goStone = [SGFCWrappingUtility wrapGoStone:_wrappedGoStonePropertyValue->GetGoStone()];
+  });
+
+  return _goStone;
+}
+
+- (SGFCColor) color
+{
+  return [SGFCMappingUtility toSgfcKitColor:_wrappedGoStonePropertyValue->GetGoStone()->GetColor()];
+}
+
+- (SGFCGoPointAxisPosition) xPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:_wrappedGoStonePropertyValue->GetGoStone()->GetLocation()->GetXPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
+- (SGFCGoPointAxisPosition) yPositionInCoordinateSystem:(SGFCCoordinateSystem)coordinateSystem
+{
+  return [SGFCMappingUtility toSgfcKitGoPointAxisPosition:_wrappedGoStonePropertyValue->GetGoStone()->GetLocation()->GetYPosition(
+    [SGFCMappingUtility fromSgfcKitCoordinateSystem:coordinateSystem])];
+}
+
 #pragma mark - SGFCStonePropertyValue overrides
 
 - (SGFCGoStonePropertyValue*) toGoStoneValue
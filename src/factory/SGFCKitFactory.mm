@@ -17,9 +17,14 @@
 // Project includes
 #import "../../include/SGFCArguments.h"
 #import "../../include/SGFCCommandLine.h"
+#import "../../include/SGFCCompiledArguments.h"
 #import "../../include/SGFCDocument.h"
 #import "../../include/SGFCDocumentReader.h"
+#import "../../include/SGFCDocumentReaderPool.h"
+#import "../../include/SGFCDocumentSnapshot.h"
+#import "../../include/SGFCDocumentValidator.h"
 #import "../../include/SGFCDocumentWriter.h"
+#import "../../include/SGFCDocumentWriterPool.h"
 #import "../../include/SGFCGame.h"
 #import "../../include/SGFCGoGameInfo.h"
 #import "../../include/SGFCNode.h"
@@ -35,11 +40,21 @@
   return [SGFCArguments emptyArguments];
 }
 
++ (SGFCCompiledArguments*) compiledArgumentsWithArguments:(SGFCArguments*)arguments
+{
+  return [SGFCCompiledArguments compiledArgumentsWithArguments:arguments];
+}
+
 + (SGFCCommandLine*) commandLineWithArguments:(SGFCArguments*)arguments
 {
   return [SGFCCommandLine commandLineWithArguments:arguments];
 }
 
++ (SGFCCommandLine*) commandLineWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [SGFCCommandLine commandLineWithCompiledArguments:compiledArguments];
+}
+
 + (SGFCCommandLine*) commandLineWithNoArguments
 {
   return [SGFCCommandLine commandLineWithNoArguments];
@@ -50,11 +65,35 @@
   return [SGFCDocumentReader documentReader];
 }
 
++ (SGFCDocumentReader*) documentReaderWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [SGFCDocumentReader documentReaderWithCompiledArguments:compiledArguments];
+}
+
++ (SGFCDocumentReaderPool*) documentReaderPoolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                                               maximumPoolSize:(NSUInteger)maximumPoolSize
+{
+  return [SGFCDocumentReaderPool poolWithCompiledArguments:compiledArguments
+                                          maximumPoolSize:maximumPoolSize];
+}
+
 + (SGFCDocumentWriter*) documentWriter
 {
   return [SGFCDocumentWriter documentWriter];
 }
 
++ (SGFCDocumentWriter*) documentWriterWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [SGFCDocumentWriter documentWriterWithCompiledArguments:compiledArguments];
+}
+
++ (SGFCDocumentWriterPool*) documentWriterPoolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                                               maximumPoolSize:(NSUInteger)maximumPoolSize
+{
+  return [SGFCDocumentWriterPool poolWithCompiledArguments:compiledArguments
+                                          maximumPoolSize:maximumPoolSize];
+}
+
 + (SGFCDocument*) document
 {
   return [SGFCDocument document];
@@ -65,6 +104,26 @@
   return [SGFCDocument documentWithGame:game];
 }
 
++ (SGFCDocumentSnapshot*) documentSnapshotWithData:(NSData*)snapshotData
+{
+  return [SGFCDocumentSnapshot snapshotWithData:snapshotData];
+}
+
++ (SGFCDocumentSnapshot*) documentSnapshotWithContentsOfFile:(NSString*)snapshotFilePath
+{
+  return [SGFCDocumentSnapshot snapshotWithContentsOfFile:snapshotFilePath];
+}
+
++ (SGFCDocumentSnapshot*) documentSnapshotWithDocument:(SGFCDocument*)document
+{
+  return [SGFCDocumentSnapshot snapshotWithDocument:document];
+}
+
++ (SGFCDocumentValidator*) documentValidator
+{
+  return [SGFCDocumentValidator documentValidator];
+}
+
 + (SGFCGame*) game
 {
   return [SGFCGame game];
@@ -18,6 +18,7 @@
 #import "../../include/SGFCGameInfo.h"
 #import "../interface/internal/SGFCGameInfoInternalAdditions.h"
 #import "../interface/internal/SGFCGoGameInfoInternalAdditions.h"
+#import "../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../interface/internal/SGFCNodeInternalAdditions.h"
 #import "../SGFCExceptionUtility.h"
 #import "../SGFCMappingUtility.h"
@@ -64,6 +65,7 @@
     return nil;
 
   _wrappedGameInfo = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGameInfo();
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
 
   // At this point self can be one of two things:
   // - An SGFCGameInfo object, if the alloc message was sent to the
@@ -89,6 +91,7 @@
   // Create the actual wrapped object. Don't assign it to the member variable
   // yet in case we are going to deallocate self.
   auto wrappedGameInfo = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGameInfo([rootNode wrappedNode]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   if (wrappedGameInfo->ToGoGameInfo() == nullptr)
   {
     // The externally allocated self has the correct type, so we can simply
@@ -129,6 +132,7 @@
   // Create the actual wrapped object. Don't assign it to the member variable
   // yet in case we are going to deallocate self.
   auto wrappedGameInfo = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateGameInfo([rootNode wrappedNode], [gameInfoNode wrappedNode]);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::LibSgfcObjectCount);
   if (wrappedGameInfo->ToGoGameInfo() == nullptr)
   {
     // The externally allocated self has the correct type, so we can simply
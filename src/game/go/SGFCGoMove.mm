@@ -26,11 +26,15 @@
 #import <libsgfcplusplus/ISgfcGoMove.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <mutex>
+
 #pragma mark - Class extension
 
 @interface SGFCGoMove()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcGoMove> _wrappedGoMove;
+  std::once_flag _stoneOnceFlag;
 }
 
 - (instancetype) initWithWrappedGoMove:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGoMove>)wrappedGoMove NS_DESIGNATED_INITIALIZER;
@@ -55,11 +59,7 @@
 
   _wrappedGoMove = wrappedGoMove;
 
-  auto wrappedStone = _wrappedGoMove->GetStone();
-  if (wrappedStone == nullptr)
-    self.stone = nil;
-  else
-    self.stone = [SGFCWrappingUtility wrapGoStone:wrappedStone];
+  // The SGFCGoStone object is created on demand when it is first accessed
 
   return self;
 }
@@ -72,6 +72,20 @@
 
 #pragma mark - Public API
 
+- (SGFCGoStone*) stone
+{
+  // std::call_once makes the first access safe if several threads read a
+  // frozen document concurrently
+  std::call_once(_stoneOnceFlag, [&]()
+  {
+    auto wrappedStone = _wrappedGoMove->GetStone();
+    if (wrappedStone != nullptr)
+      _stone = [SGFCWrappingUtility wrapGoStone:wrappedStone];
+  });
+
+  return _stone;
+}
+
 - (BOOL) isPassMove
 {
   return [SGFCMappingUtility toSgfcKitBoolean:_wrappedGoMove->IsPassMove()];
@@ -84,8 +98,9 @@
 
 - (SGFCGoPoint*) stoneLocation
 {
-  if (_stone)
-    return _stone.location;
+  SGFCGoStone* stone = self.stone;
+  if (stone)
+    return stone.location;
   else
     return nil;
 }
@@ -25,11 +25,15 @@
 #import <libsgfcplusplus/ISgfcGoStone.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <mutex>
+
 #pragma mark - Class extension
 
 @interface SGFCGoStone()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcGoStone> _wrappedGoStone;
+  std::once_flag _locationOnceFlag;
 }
 
 - (instancetype) initWithWrappedGoStone:(std::shared_ptr<LibSgfcPlusPlus::ISgfcGoStone>)wrappedGoStone NS_DESIGNATED_INITIALIZER;
@@ -54,11 +58,7 @@
 
   _wrappedGoStone = wrappedGoStone;
 
-  auto wrappedLocation = _wrappedGoStone->GetLocation();
-  if (wrappedLocation == nullptr)
-    self.location = nil;
-  else
-    self.location = [SGFCWrappingUtility wrapGoPoint:wrappedLocation];
+  // The SGFCGoPoint object is created on demand when it is first accessed
 
   return self;
 }
@@ -71,6 +71,20 @@
 
 #pragma mark - Public API
 
+- (SGFCGoPoint*) location
+{
+  // std::call_once makes the first access safe if several threads read a
+  // frozen document concurrently
+  std::call_once(_locationOnceFlag, [&]()
+  {
+    auto wrappedLocation = _wrappedGoStone->GetLocation();
+    if (wrappedLocation != nullptr)
+      _location = [SGFCWrappingUtility wrapGoPoint:wrappedLocation];
+  });
+
+  return _location;
+}
+
 - (SGFCColor) color
 {
   return [SGFCMappingUtility toSgfcKitColor:_wrappedGoStone->GetColor()];
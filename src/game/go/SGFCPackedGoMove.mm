@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../../include/SGFCPackedGoMove.h"
+
+// Prevent C++ name mangling
+extern "C"
+{
+  SGFCPackedGoMove SGFCPackedGoMoveMake(SGFCColor color, SGFCGoPointAxisPosition xPosition, SGFCGoPointAxisPosition yPosition)
+  {
+    SGFCPackedGoMove goMove;
+    goMove.Color = color;
+    goMove.IsPassMove = NO;
+    goMove.XPosition = xPosition;
+    goMove.YPosition = yPosition;
+
+    return goMove;
+  }
+
+  SGFCPackedGoMove SGFCPackedGoMoveMakePass(SGFCColor color)
+  {
+    SGFCPackedGoMove goMove;
+    goMove.Color = color;
+    goMove.IsPassMove = YES;
+    goMove.XPosition = 0;
+    goMove.YPosition = 0;
+
+    return goMove;
+  }
+}
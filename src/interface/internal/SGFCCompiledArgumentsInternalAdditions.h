@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../../../include/SGFCCompiledArguments.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcArguments.h>
+
+// C++ Standard Library includes
+#import <memory>
+
+/// @brief The SGFCCompiledArgumentsInternalAdditions category adds a
+/// library-internal API to the SGFCCompiledArguments class.
+///
+/// @ingroup internals
+/// @ingroup sgfc-arguments
+@interface SGFCCompiledArguments(SGFCCompiledArgumentsInternalAdditions)
+
+/// @brief Replaces the content of the libsgfc++ object @a wrappedArguments
+/// with the arguments that arguments() returns.
+///
+/// @exception NSInvalidArgumentException Is raised if @a wrappedArguments is
+/// @e nullptr.
+- (void) copyArgumentsToWrappedArguments:(std::shared_ptr<LibSgfcPlusPlus::ISgfcArguments>)wrappedArguments;
+
+@end
@@ -20,6 +20,7 @@
 #import "../../../include/SGFCDocumentReadResult.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
 #import <libsgfcplusplus/ISgfcDocumentReadResult.h>
 
 // C++ Standard Library includes
@@ -36,13 +37,37 @@
 /// @brief Initializes an SGFCDocumentReadResult object. The object wraps the
 /// libsgfc++ object @a wrappedDocumentReadResult.
 ///
-/// This is the designated initializer of SGFCDocumentReadResult.
+/// This is a designated initializer of SGFCDocumentReadResult.
 ///
 /// @exception NSInvalidArgumentException Is raised if
 /// @a wrappedDocumentReadResult is @e nullptr.
 - (instancetype) initWithWrappedDocumentReadResult:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>)wrappedDocumentReadResult;
 
-/// @brief Returns the wrapped libsgfc++ object.
+/// @brief Initializes an SGFCDocumentReadResult object for a read operation
+/// that bypassed SGFC and produced the libsgfc++ object @a wrappedDocument.
+/// The object has no messages, and isTrustedInputResult() returns YES.
+///
+/// This is a designated initializer of SGFCDocumentReadResult.
+///
+/// @exception NSInvalidArgumentException Is raised if @a wrappedDocument is
+/// @e nullptr.
+- (instancetype) initWithWrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument;
+
+/// @brief Sets the values that SGFCDocumentReader measured while it
+/// performed the read operation. The values are passed on to the
+/// SGFCDocumentReadStatistics object that statistics() returns.
+- (void) setReadDuration:(NSTimeInterval)readDuration
+          inputByteCount:(unsigned long long)inputByteCount;
+
+/// @brief Discards all messages that follow the message at index
+/// @a indexOfMessage in the parse result, as well as the document. After
+/// this isTruncated() returns YES, parseResult() returns a collection that
+/// ends with the message at index @a indexOfMessage, and document()
+/// returns an empty document.
+- (void) truncateAfterMessageAtIndex:(NSUInteger)indexOfMessage;
+
+/// @brief Returns the wrapped libsgfc++ object. Returns @e nullptr if the
+/// object was initialized with initWithWrappedDocument:().
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>) wrappedDocumentReadResult;
 
 @end
@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../../../include/SGFCDocumentReadStatistics.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcMessage.h>
+
+// C++ Standard Library includes
+#import <memory>
+#import <vector>
+
+/// @brief The SGFCDocumentReadStatisticsInternalAdditions category adds a
+/// library-internal API to the SGFCDocumentReadStatistics class.
+///
+/// @ingroup internals
+/// @ingroup sgfc-frontend
+/// @ingroup document
+@interface SGFCDocumentReadStatistics(SGFCDocumentReadStatisticsInternalAdditions)
+
+/// @brief Initializes an SGFCDocumentReadStatistics object with statistics
+/// about the read operation that produced the messages @a parseResult and
+/// the document @a document. @a readDuration and @a inputByteCount are
+/// measured by the caller, all other values are determined from
+/// @a parseResult and @a document.
+///
+/// This is the designated initializer of SGFCDocumentReadStatistics.
+- (instancetype) initWithParseResult:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)parseResult
+                            document:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document
+                        readDuration:(NSTimeInterval)readDuration
+                      inputByteCount:(unsigned long long)inputByteCount;
+
+@end
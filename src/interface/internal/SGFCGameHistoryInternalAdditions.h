@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../../../include/SGFCGameHistory.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+
+// C++ Standard Library includes
+#import <functional>
+#import <memory>
+#import <vector>
+
+/// @brief A function that restores a part of a game tree to the state it had
+/// when the function was created.
+typedef std::function<void()> SGFCGameHistoryRestoreFunction;
+
+/// @brief The SGFCGameHistoryInternalAdditions category adds a
+/// library-internal API to the SGFCGameHistory class.
+///
+/// @ingroup internals
+/// @ingroup game-tree
+///
+/// A class that modifies the game tree records a change like this: Before
+/// the modification it obtains restore functions for the parts of the game
+/// tree that the modification is going to affect. After the modification it
+/// obtains restore functions for the same parts again, and passes both sets
+/// of functions to recordChangeWithUndoFunction:redoFunction:().
+///
+/// A restore function captures the entire state of a part of the game tree,
+/// so its cost is proportional to the size of that part. A modification that
+/// adds or removes a single property or property value should therefore
+/// record the delta instead, using the functions that append, insert or
+/// remove exactly the affected objects. The functions of a version are
+/// always executed in the order in which the changes were made (or in the
+/// reverse order), so each function finds the game tree in the same state
+/// as the original modification found it.
+@interface SGFCGameHistory(SGFCGameHistoryInternalAdditions)
+
+/// @brief Initializes an SGFCGameHistory object that records the changes to
+/// the game tree of @a game.
+///
+/// This is the designated initializer of SGFCGameHistory.
+///
+/// @exception NSInvalidArgumentException Is raised if @a game is @e nil.
+- (instancetype) initWithGame:(SGFCGame*)game;
+
+/// @brief Returns a number that changes every time that the SGFCGameHistory
+/// reverts or re-applies a version. SGFCNode, SGFCProperty and
+/// SGFCValidationCache compare the number to a previously stored value to
+/// find out whether the objects they cache might be stale.
+///
+/// Each SGFCGameHistory counts separately, so an undo or redo in one game
+/// does not affect the caches of objects that belong to other games.
+- (NSUInteger) undoRedoCount;
+
+/// @brief Returns a function that restores the properties of @a node, and
+/// the values of these properties, to their current state.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForPropertiesOfNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that restores the values of @a property to
+/// their current state.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForValuesOfProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property;
+
+/// @brief Returns a function that sets @a property as a property of
+/// @a node, replacing an existing property of the same name.
+- (SGFCGameHistoryRestoreFunction) setFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                      node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that appends @a property to the properties of
+/// @a node.
+- (SGFCGameHistoryRestoreFunction) appendFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that inserts @a property into the properties
+/// of @a node at index position @a indexOfProperty. If @a indexOfProperty
+/// is equal to the number of properties at the time the function is
+/// executed, the function appends @a property.
+- (SGFCGameHistoryRestoreFunction) insertFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                        index:(NSUInteger)indexOfProperty
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that removes @a property from the properties
+/// of @a node.
+- (SGFCGameHistoryRestoreFunction) removeFunctionWithProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property
+                                                         node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that appends @a propertyValues, in the given
+/// order, to the values of @a property.
+- (SGFCGameHistoryRestoreFunction) appendFunctionWithPropertyValues:(std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>)propertyValues
+                                                           property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property;
+
+/// @brief Returns a function that inserts @a propertyValue into the values
+/// of @a property at index position @a indexOfPropertyValue. If
+/// @a indexOfPropertyValue is equal to the number of values at the time the
+/// function is executed, the function appends @a propertyValue.
+- (SGFCGameHistoryRestoreFunction) insertFunctionWithPropertyValue:(std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>)propertyValue
+                                                             index:(NSUInteger)indexOfPropertyValue
+                                                          property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property;
+
+/// @brief Returns a function that removes @a propertyValues from the values
+/// of @a property.
+- (SGFCGameHistoryRestoreFunction) removeFunctionWithPropertyValues:(std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcPropertyValue>>)propertyValues
+                                                           property:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)property;
+
+/// @brief Returns a function that restores the children of @a node to
+/// their current state. Returns a function that does nothing if @a node is
+/// @e nullptr.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForChildrenOfNode:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Returns a function that restores the root node of the game to
+/// the current root node.
+- (SGFCGameHistoryRestoreFunction) restoreFunctionForRootNode;
+
+/// @brief Records a change. @a undoFunction reverts the change,
+/// @a redoFunction applies the change again. Discards all versions that
+/// could have been re-applied with redo().
+- (void) recordChangeWithUndoFunction:(SGFCGameHistoryRestoreFunction)undoFunction
+                         redoFunction:(SGFCGameHistoryRestoreFunction)redoFunction;
+
+@end
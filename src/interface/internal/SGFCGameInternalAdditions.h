@@ -25,6 +25,9 @@
 // C++ Standard Library includes
 #import <memory>
 
+// Forward declarations
+@class SGFCValidationCache;
+
 /// @brief The SGFCGameInternalAdditions category adds a library-internal API to
 /// the SGFCGame class.
 ///
@@ -42,4 +45,17 @@
 /// @brief Returns the wrapped libsgfc++ object.
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcGame>) wrappedGame;
 
+/// @brief Returns the validation cache that validateIncrementally() uses.
+/// Objects that modify the game tree notify the validation cache of their
+/// changes.
+- (SGFCValidationCache*) validationCache;
+
+/// @brief Sets the game tree's root node to @a rootNode without recording
+/// the change in the game's history. @a rootNode may be @e nil.
+- (void) restoreRootNode:(SGFCNode*)rootNode;
+
+/// @brief Makes the SGFCGame object immutable. Also freezes the root node.
+/// Does nothing if the SGFCGame object is already frozen.
+- (void) freeze;
+
 @end
@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#import "../../../include/SGFCKitMetrics.h"
+
+// C++ Standard Library includes
+#import <atomic>
+#import <chrono>
+#import <cstdint>
+#import <memory>
+
+// Forward declarations
+namespace LibSgfcPlusPlus
+{
+  class ISgfcDocument;
+}
+
+/// @brief Enumerates the counters that SGFCKitMetrics maintains. Counters
+/// that measure a duration hold nanoseconds.
+///
+/// @ingroup internals
+/// @ingroup library-support
+enum class SGFCKitMetricsCounter : std::size_t
+{
+  ReadCount,
+  WriteCount,
+  ReadDuration,
+  WriteDuration,
+  BytesRead,
+  BytesWritten,
+  NodeCount,
+  PropertyCount,
+  PropertyValueCount,
+  WrapDuration,
+  DocumentWrapperCount,
+  GameWrapperCount,
+  NodeWrapperCount,
+  PropertyWrapperCount,
+  PropertyValueWrapperCount,
+  GoObjectWrapperCount,
+  MessageWrapperCount,
+  OtherWrapperCount,
+  MappingCount,
+  StringCopyCount,
+  LibSgfcObjectCount,
+  BackgroundReclamationCount,
+  BackgroundReclamationDuration,
+  BackgroundReclamationLag,
+  /// @brief Not a counter, the number of counters.
+  NumberOfCounters
+};
+
+/// @brief Is @e true if SGFCKitMetrics is enabled. Use
+/// SGFCKitMetricsIsEnabled() to query the flag.
+extern std::atomic<bool> SGFCKitMetricsEnabled;
+
+/// @brief The storage for the counters that SGFCKitMetrics maintains,
+/// indexed by SGFCKitMetricsCounter. Use SGFCKitMetricsAdd() to update a
+/// counter.
+extern std::atomic<std::uint64_t> SGFCKitMetricsCounters[static_cast<std::size_t>(SGFCKitMetricsCounter::NumberOfCounters)];
+
+/// @brief Returns @e true if SGFCKitMetrics is enabled. Instrumentation
+/// points that have to do extra work to obtain a value (e.g. determine a
+/// byte count) should query this first.
+inline bool SGFCKitMetricsIsEnabled()
+{
+  return SGFCKitMetricsEnabled.load(std::memory_order_relaxed);
+}
+
+/// @brief Adds @a amount to @a counter if SGFCKitMetrics is enabled. Does
+/// nothing if SGFCKitMetrics is disabled.
+inline void SGFCKitMetricsAdd(SGFCKitMetricsCounter counter, std::uint64_t amount = 1)
+{
+  if (SGFCKitMetricsIsEnabled())
+    SGFCKitMetricsCounters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+/// @brief The SGFCKitMetricsStopwatch class measures the time between its
+/// construction and its destruction and adds the duration to a counter.
+/// SGFCKitMetricsStopwatch does not query the clock if SGFCKitMetrics is
+/// disabled when the object is constructed.
+///
+/// @ingroup internals
+/// @ingroup library-support
+///
+/// Stopwatches for the same counter may be nested, e.g. when a wrapping
+/// function invokes another wrapping function. Only the outermost
+/// stopwatch of a thread measures, otherwise the time spent in the inner
+/// function would be added to the counter twice. The nesting level is
+/// tracked per thread and per counter.
+class SGFCKitMetricsStopwatch
+{
+public:
+  explicit SGFCKitMetricsStopwatch(SGFCKitMetricsCounter counter)
+    : counter(counter)
+    , isActive(SGFCKitMetricsIsEnabled())
+    , isRunning(false)
+  {
+    if (! isActive)
+      return;
+
+    isRunning = (nestingLevels[static_cast<std::size_t>(counter)]++ == 0);
+    if (isRunning)
+      startTime = std::chrono::steady_clock::now();
+  }
+
+  ~SGFCKitMetricsStopwatch()
+  {
+    if (! isActive)
+      return;
+
+    nestingLevels[static_cast<std::size_t>(counter)]--;
+    if (! isRunning)
+      return;
+
+    auto duration = std::chrono::steady_clock::now() - startTime;
+    SGFCKitMetricsAdd(
+      counter,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+  }
+
+  SGFCKitMetricsStopwatch(const SGFCKitMetricsStopwatch&) = delete;
+  SGFCKitMetricsStopwatch& operator=(const SGFCKitMetricsStopwatch&) = delete;
+
+private:
+  /// @brief The number of stopwatches that currently exist on this thread,
+  /// indexed by SGFCKitMetricsCounter. Only stopwatches that were
+  /// constructed while SGFCKitMetrics was enabled are counted.
+  static inline thread_local unsigned int nestingLevels[static_cast<std::size_t>(SGFCKitMetricsCounter::NumberOfCounters)] = {};
+
+  SGFCKitMetricsCounter counter;
+  /// @brief Is @e true if the stopwatch contributes to nestingLevels.
+  bool isActive;
+  /// @brief Is @e true if the stopwatch is the outermost stopwatch and
+  /// measures the time.
+  bool isRunning;
+  std::chrono::steady_clock::time_point startTime;
+};
+
+/// @brief The SGFCKitMetricsInternalAdditions category adds a
+/// library-internal API to the SGFCKitMetrics class.
+///
+/// @ingroup internals
+/// @ingroup library-support
+@interface SGFCKitMetrics(SGFCKitMetricsInternalAdditions)
+
+/// @brief Adds the number of nodes, properties and property values in
+/// @a document to the corresponding counters. Does nothing if SGFCKitMetrics
+/// is disabled, or if @a document is @e nullptr.
++ (void) recordContentOfDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document;
+
+@end
@@ -41,7 +41,21 @@
 /// @e nullptr.
 - (instancetype) initWithWrappedMessage:(std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>)wrappedMessage;
 
-/// @brief Returns the wrapped libsgfc++ object.
+/// @brief Initializes an SGFCMessage object that was not generated by
+/// SGFC, but by SgfcKit itself. The object wraps no libsgfc++ object. Its
+/// line and column numbers are #SGFCInvalidLineNumber and
+/// #SGFCInvalidColumnNumber, and it is not a critical message.
+///
+/// This is a designated initializer of SGFCMessage.
+///
+/// @exception NSInvalidArgumentException Is raised if @a messageText is
+/// @e nil.
+- (instancetype) initWithMessageID:(SGFCMessageID)messageID
+                       messageType:(SGFCMessageType)messageType
+                       messageText:(NSString*)messageText;
+
+/// @brief Returns the wrapped libsgfc++ object. Returns @e nullptr if the
+/// message was not generated by SGFC.
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>) wrappedMessage;
 
 @end
@@ -25,6 +25,10 @@
 // C++ Standard Library includes
 #import <memory>
 
+// Forward declarations
+@class SGFCGameHistory;
+@class SGFCValidationCache;
+
 /// @brief The SGFCNodeInternalAdditions category adds a library-internal API to
 /// the SGFCNode class.
 ///
@@ -42,4 +46,30 @@
 /// @brief Returns the wrapped libsgfc++ object.
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>) wrappedNode;
 
+/// @brief Sets the history that records the changes made through the
+/// SGFCNode object to @a history. Also sets the history of the SGFCProperty
+/// objects in properties(). @a history may be @e nil.
+///
+/// SGFCNode and SGFCProperty objects that the SGFCNode object returns from
+/// now on are associated with the same history.
+- (void) setHistory:(SGFCGameHistory*)history;
+
+/// @brief Sets the validation cache that is notified of the changes made
+/// through the SGFCNode object to @a validationCache. Also sets the
+/// validation cache of the SGFCProperty objects in properties().
+/// @a validationCache may be @e nil.
+///
+/// SGFCNode and SGFCProperty objects that the SGFCNode object returns from
+/// now on are associated with the same validation cache.
+- (void) setValidationCache:(SGFCValidationCache*)validationCache;
+
+/// @brief Makes the SGFCNode object immutable. Also freezes the SGFCProperty
+/// objects in properties(). Does nothing if the SGFCNode object is already
+/// frozen.
+///
+/// All values that SGFCNode otherwise computes on demand are computed
+/// eagerly so that a frozen SGFCNode object can be read from multiple
+/// threads without synchronization.
+- (void) freeze;
+
 @end
@@ -20,11 +20,16 @@
 #import "../../../include/SGFCProperty.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcNode.h>
 #import <libsgfcplusplus/ISgfcProperty.h>
 
 // C++ Standard Library includes
 #import <memory>
 
+// Forward declarations
+@class SGFCGameHistory;
+@class SGFCValidationCache;
+
 /// @brief The SGFCPropertyInternalAdditions category adds a
 /// library-internal API to the SGFCProperty class.
 ///
@@ -56,4 +61,20 @@
 - (void) setWrappedProperty:(std::shared_ptr<LibSgfcPlusPlus::ISgfcProperty>)wrappedProperty
              propertyValues:(NSArray*)propertyValues;
 
+/// @brief Sets the history that records the changes made through the
+/// SGFCProperty object to @a history. @a history may be @e nil.
+- (void) setHistory:(SGFCGameHistory*)history;
+
+/// @brief Sets the validation cache that is notified of the changes made
+/// through the SGFCProperty object to @a validationCache. A change is
+/// reported as a change of the properties of @a node, i.e. @a node must be
+/// the libsgfc++ node that contains the property. @a validationCache may be
+/// @e nil.
+- (void) setValidationCache:(SGFCValidationCache*)validationCache
+                       node:(std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>)node;
+
+/// @brief Makes the SGFCProperty object immutable. Does nothing if the
+/// SGFCProperty object is already frozen.
+- (void) freeze;
+
 @end
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../../include/SGFCCompiledArguments.h"
+#import "../../../include/SGFCMessage.h"
+#import "../../interface/internal/SGFCArgumentsInternalAdditions.h"
+#import "../../interface/internal/SGFCCompiledArgumentsInternalAdditions.h"
+#import "../../SGFCExceptionUtility.h"
+#import "../../SGFCWrappingUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcArgument.h>
+#import <libsgfcplusplus/ISgfcCommandLine.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
+
+// System includes
+#import <Foundation/NSArray.h>
+
+// C++ Standard Library includes
+#import <vector>
+
+#pragma mark - Class extension
+
+@interface SGFCCompiledArguments()
+{
+  std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcArgument>> _wrappedArgumentCollection;
+}
+
+@property(nonatomic, strong, readwrite) NSArray* arguments;
+@property(nonatomic, readwrite, getter=isValid) BOOL valid;
+@property(nonatomic, strong, readwrite) SGFCMessage* invalidReason;
+
+@end
+
+#pragma mark - Helper functions
+
+namespace
+{
+  void AddArgument(LibSgfcPlusPlus::ISgfcArguments& arguments, const LibSgfcPlusPlus::ISgfcArgument& argument)
+  {
+    auto argumentType = argument.GetArgumentType();
+
+    if (argument.HasIntegerTypeParameter())
+      arguments.AddArgument(argumentType, argument.GetIntegerTypeParameter());
+    else if (argument.HasStringTypeParameter())
+      arguments.AddArgument(argumentType, argument.GetStringTypeParameter());
+    else if (argument.HasPropertyTypeParameter())
+      arguments.AddArgument(argumentType, argument.GetPropertyTypeParameter());
+    else if (argument.HasMessageIDParameter())
+      arguments.AddArgument(argumentType, argument.GetMessageIDParameter());
+    else
+      arguments.AddArgument(argumentType);
+  }
+}
+
+@implementation SGFCCompiledArguments
+
+#pragma mark - Initialization and deallocation
+
++ (instancetype) compiledArgumentsWithArguments:(SGFCArguments*)arguments
+{
+  return [[self alloc] initWithArguments:arguments];
+}
+
+- (instancetype) initWithArguments:(SGFCArguments*)arguments
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:arguments
+                                                 invalidArgumentName:@"arguments"];
+
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  // The command line validates the arguments the same way as SGFC does when
+  // it is invoked on the command line. It also makes a copy of the
+  // arguments that nobody else has access to, so we can keep that copy
+  // without fear of it being changed.
+  auto wrappedCommandLine = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateSgfcCommandLine(
+    [arguments wrappedArguments]);
+
+  _wrappedArgumentCollection = wrappedCommandLine->GetArguments();
+  self.arguments = [SGFCWrappingUtility wrapArgumentCollection:_wrappedArgumentCollection];
+
+  if (wrappedCommandLine->IsCommandLineValid())
+  {
+    self.valid = YES;
+    self.invalidReason = nil;
+  }
+  else
+  {
+    self.valid = NO;
+    self.invalidReason = [SGFCWrappingUtility wrapMessage:wrappedCommandLine->GetInvalidCommandLineReason()];
+
+    // SGFCMessage creates the message texts lazily. Create them now so that
+    // the message object is not modified when it is accessed concurrently
+    // from different threads.
+    (void)self.invalidReason.messageText;
+    (void)self.invalidReason.formattedMessageText;
+  }
+
+  return self;
+}
+
+- (void) dealloc
+{
+  _wrappedArgumentCollection.clear();
+  self.arguments = nil;
+  self.invalidReason = nil;
+}
+
+#pragma mark - Internal API - SGFCCompiledArgumentsInternalAdditions overrides
+
+- (void) copyArgumentsToWrappedArguments:(std::shared_ptr<LibSgfcPlusPlus::ISgfcArguments>)wrappedArguments
+{
+  if (wrappedArguments == nullptr)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"wrappedArguments\" is nullptr"];
+
+  wrappedArguments->ClearArguments();
+
+  // The arguments were accepted by libsgfc++ when they were added to the
+  // SGFCArguments object that we were constructed from, so adding them once
+  // more cannot fail
+  for (const auto& wrappedArgument : _wrappedArgumentCollection)
+    AddArgument(*wrappedArguments, *wrappedArgument);
+}
+
+@end
@@ -16,9 +16,12 @@
 
 // Project includes
 #import "../../../include/SGFCCommandLine.h"
+#import "../../../include/SGFCCompiledArguments.h"
 #import "../../interface/internal/SGFCArgumentsInternalAdditions.h"
+#import "../../interface/internal/SGFCCompiledArgumentsInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
 #import "../../SGFCMappingUtility.h"
+#import "../../SGFCMessageUtility.h"
 #import "../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
@@ -33,6 +36,8 @@
 @interface SGFCCommandLine()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcCommandLine> _wrappedCommandLine;
+  BOOL _sgfContentDiscarded;
+  BOOL _saveResultDiscarded;
 }
 
 @property(nonatomic, strong, readwrite) NSArray* arguments;
@@ -51,6 +56,11 @@
   return [[self alloc] initWithArguments:arguments];
 }
 
++ (instancetype) commandLineWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [[self alloc] initWithCompiledArguments:compiledArguments];
+}
+
 + (instancetype) commandLineWithNoArguments
 {
   return [[self alloc] initWithNoArguments];
@@ -79,6 +89,27 @@
   return self;
 }
 
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:compiledArguments
+                                                 invalidArgumentName:@"compiledArguments"];
+  if (! compiledArguments.isValid)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"compiledArguments\" is not valid"];
+
+  self = [self initWithNoArguments];
+
+  auto wrappedArguments = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateSgfcArguments();
+  [compiledArguments copyArgumentsToWrappedArguments:wrappedArguments];
+  _wrappedCommandLine = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateSgfcCommandLine(
+    wrappedArguments);
+
+  // The wrapper objects of SGFCCompiledArguments never change, so unlike
+  // initWithArguments:() we can share them instead of creating new ones
+  self.arguments = compiledArguments.arguments;
+
+  return self;
+}
+
 - (instancetype) initWithNoArguments
 {
   // Call designated initializer of superclass (NSObject)
@@ -88,10 +119,13 @@
 
   _wrappedCommandLine = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateSgfcCommandLine();
   self.arguments = [NSArray array];
+  _sgfContentDiscarded = NO;
+  _saveResultDiscarded = NO;
 
   self.invalidCommandLineReason = nil;
   self.parseResult = nil;
   self.saveResult = nil;
+  self.messageHandler = nil;
 
   return self;
 }
@@ -103,6 +137,7 @@
   self.invalidCommandLineReason = nil;
   self.parseResult = nil;
   self.saveResult = nil;
+  self.messageHandler = nil;
 }
 
 #pragma mark - Public API
@@ -114,12 +149,12 @@
 
 - (SGFCMessage*) invalidCommandLineReason
 {
-  if (self.invalidCommandLineReason == nil)
+  if (_invalidCommandLineReason == nil)
   {
     try
     {
       auto wrappedMessage = _wrappedCommandLine->GetInvalidCommandLineReason();
-      self.invalidCommandLineReason = [SGFCWrappingUtility wrapMessage:wrappedMessage];
+      _invalidCommandLineReason = [SGFCWrappingUtility wrapMessage:wrappedMessage];
     }
     catch (std::logic_error& exception)
     {
@@ -127,7 +162,7 @@
     }
   }
 
-  return self.invalidCommandLineReason;
+  return _invalidCommandLineReason;
 }
 
 - (SGFCExitCode) loadSgfContentFromFile:(NSString*)sgfFilePath
@@ -139,8 +174,12 @@
 
   try
   {
-    return [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->LoadSgfFile(
+    SGFCExitCode exitCode = [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->LoadSgfFile(
       [SGFCMappingUtility fromSgfcKitString:sgfFilePath])];
+    if (self.messageHandler)
+      [self passMessagesToMessageHandler:_wrappedCommandLine->GetParseResult()];
+
+    return exitCode;
   }
   catch (std::logic_error& exception)
   {
@@ -161,8 +200,12 @@
 
   try
   {
-    return [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->LoadSgfContent(
+    SGFCExitCode exitCode = [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->LoadSgfContent(
       [SGFCMappingUtility fromSgfcKitString:sgfContent])];
+    if (self.messageHandler)
+      [self passMessagesToMessageHandler:_wrappedCommandLine->GetParseResult()];
+
+    return exitCode;
   }
   catch (std::logic_error& exception)
   {
@@ -178,7 +221,11 @@
 {
   try
   {
-    return [SGFCMappingUtility toSgfcKitBoolean:_wrappedCommandLine->IsSgfContentValid()];
+    bool isSgfContentValid = _wrappedCommandLine->IsSgfContentValid();
+    if (_sgfContentDiscarded)
+      return NO;
+
+    return [SGFCMappingUtility toSgfcKitBoolean:isSgfContentValid];
   }
   catch (std::logic_error& exception)
   {
@@ -192,38 +239,56 @@
 
 - (NSArray*) parseResult
 {
-  if (self.parseResult)
+  if (_parseResult)
   {
     // Reuse a previously created array to provide stable wrapper objects.
     // The cached array object is cleared when new SGF content is loaded.
   }
   else
   {
-    try
-    {
-      self.parseResult = [SGFCWrappingUtility wrapMessages:_wrappedCommandLine->GetParseResult()];
-    }
-    catch (std::logic_error& exception)
-    {
-      [SGFCExceptionUtility raiseInvalidOperationExceptionWithCStringReason:exception.what()];
-    }
+    _parseResult = [SGFCWrappingUtility wrapMessages:[self wrappedParseResult]];
   }
 
-  return self.parseResult;
+  return _parseResult;
+}
 
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType
+{
+  return [SGFCMessageUtility numberOfMessages:[self wrappedParseResult]
+                                     withType:messageType];
+}
+
+- (NSArray*) messagesWithType:(SGFCMessageType)messageType limit:(NSUInteger)limit
+{
+  return [SGFCMessageUtility messages:[self wrappedParseResult]
+                             withType:messageType
+                                limit:limit
+                      wrappedMessages:_parseResult];
+}
+
+- (SGFCMessage*) firstCriticalMessage
+{
+  return [SGFCMessageUtility firstCriticalMessage:[self wrappedParseResult]
+                                  wrappedMessages:_parseResult];
 }
 
 - (SGFCExitCode) saveSgfContentToFile:(NSString*)sgfFilePath
 {
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:sgfFilePath
                                                  invalidArgumentName:@"sgfFilePath"];
+  [self raiseInvalidOperationExceptionIfSgfContentDiscarded];
 
   [self invalidateCacheOnSaveOperation];
 
   try
   {
-    return [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->SaveSgfFile(
+    SGFCExitCode exitCode = [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->SaveSgfFile(
       [SGFCMappingUtility fromSgfcKitString:sgfFilePath])];
+    _saveResultDiscarded = NO;
+    if (self.messageHandler)
+      [self passMessagesToMessageHandler:_wrappedCommandLine->GetSaveResult()];
+
+    return exitCode;
   }
   catch (std::logic_error& exception)
   {
@@ -252,6 +317,7 @@
 {
   [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:*sgfContent
                                                  invalidArgumentName:@"sgfContent"];
+  [self raiseInvalidOperationExceptionIfSgfContentDiscarded];
 
   [self invalidateCacheOnSaveOperation];
 
@@ -260,6 +326,10 @@
     std::string wrappedSgfContent;
     SGFCExitCode exitCode = [SGFCMappingUtility toSgfcKitExitCode:_wrappedCommandLine->SaveSgfContent(
       wrappedSgfContent)];
+    _saveResultDiscarded = NO;
+
+    if (self.messageHandler)
+      [self passMessagesToMessageHandler:_wrappedCommandLine->GetSaveResult()];
 
     *sgfContent = [SGFCMappingUtility toSgfcKitString:wrappedSgfContent];
     return exitCode;
@@ -276,16 +346,20 @@
 
 - (NSArray*) saveResult
 {
-  if (self.saveResult)
+  if (_saveResult)
   {
     // Reuse a previously created array to provide stable wrapper objects.
-    // The cached array object is cleared when new SGF content is loaded.
+    // The cached array object is cleared when new SGF content is saved.
+  }
+  else if (_saveResultDiscarded)
+  {
+    _saveResult = [NSArray array];
   }
   else
   {
     try
     {
-      self.saveResult = [SGFCWrappingUtility wrapMessages:_wrappedCommandLine->GetSaveResult()];
+      _saveResult = [SGFCWrappingUtility wrapMessages:_wrappedCommandLine->GetSaveResult()];
     }
     catch (std::logic_error& exception)
     {
@@ -293,12 +367,73 @@
     }
   }
 
-  return self.saveResult;
+  return _saveResult;
+}
+
+- (void) reset
+{
+  self.parseResult = nil;
+  self.saveResult = nil;
+
+  // An invalid command line can neither load nor save, the accessors keep
+  // raising an exception regardless of whether we discard anything
+  if (! _wrappedCommandLine->IsCommandLineValid())
+    return;
+
+  // The wrapped command line has no means to discard its state, and we don't
+  // want to recreate it because that would copy the arguments once more.
+  // Instead we pretend that the state is gone until the next load/save
+  // operation replaces it.
+  _sgfContentDiscarded = YES;
+  _saveResultDiscarded = YES;
+}
+
+#pragma mark - Private API
+
+// The caller checks whether there is a message handler, so that the
+// messages are not copied out of the wrapped command line in vain
+- (void) passMessagesToMessageHandler:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)messages
+{
+  [SGFCMessageUtility passMessages:messages
+                             limit:NSUIntegerMax
+                  toMessageHandler:self.messageHandler];
+}
+
+// Returns the parse result of the wrapped command line. Raises an
+// SGFCInvalidOperationException if the command line is not valid.
+- (std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>) wrappedParseResult
+{
+  try
+  {
+    auto parseResult = _wrappedCommandLine->GetParseResult();
+    if (_sgfContentDiscarded)
+      return {};
+
+    return parseResult;
+  }
+  catch (std::logic_error& exception)
+  {
+    [SGFCExceptionUtility raiseInvalidOperationExceptionWithCStringReason:exception.what()];
+
+    // Dummy return to make compiler happy (compiler does not see that an
+    // exception is raised)
+    return {};
+  }
+}
+
+- (void) raiseInvalidOperationExceptionIfSgfContentDiscarded
+{
+  if (_sgfContentDiscarded)
+  {
+    [SGFCExceptionUtility raiseInvalidOperationExceptionWithReason:
+     @"SGF content cannot be saved because the command line was reset and no new SGF content has been loaded since then"];
+  }
 }
 
 - (void) invalidateCacheOnLoadOperation
 {
   self.parseResult = nil;
+  _sgfContentDiscarded = NO;
 
   // The ISgfcCommandLine documentation clearly states that GetSaveResult()
   // returns the result of the **most recent** save operation. This means that
@@ -17,23 +17,33 @@
 // Project includes
 #import "../../../include/SGFCDocumentReadResult.h"
 #import "../../interface/internal/SGFCDocumentReadResultInternalAdditions.h"
+#import "../../interface/internal/SGFCDocumentReadStatisticsInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
 #import "../../SGFCMappingUtility.h"
+#import "../../SGFCMessageUtility.h"
 #import "../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
 #import <libsgfcplusplus/ISgfcDocumentReadResult.h>
+#import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
 #pragma mark - Class extension
 
 @interface SGFCDocumentReadResult()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult> _wrappedDocumentReadResult;
+  std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument> _wrappedDocument;
   NSArray* _parseResult;
   SGFCDocument* _document;
+  SGFCDocumentReadStatistics* _statistics;
+  NSTimeInterval _readDuration;
+  unsigned long long _inputByteCount;
+  BOOL _truncated;
+  NSUInteger _numberOfMessages;
 }
 
 - (instancetype) initWithWrappedDocumentReadResult:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>)wrappedDocumentReadResult NS_DESIGNATED_INITIALIZER;
+- (instancetype) initWithWrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument NS_DESIGNATED_INITIALIZER;
 
 @end
 
@@ -52,8 +62,37 @@
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"wrappedDocumentReadResult\" is nullptr"];
 
   _wrappedDocumentReadResult = wrappedDocumentReadResult;
+  _wrappedDocument = nullptr;
   _parseResult = nil;
   _document = nil;
+  _statistics = nil;
+  _readDuration = 0;
+  _inputByteCount = 0;
+  _truncated = NO;
+  _numberOfMessages = 0;
+
+  return self;
+}
+
+- (instancetype) initWithWrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  if (wrappedDocument == nullptr)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"wrappedDocument\" is nullptr"];
+
+  _wrappedDocumentReadResult = nullptr;
+  _wrappedDocument = wrappedDocument;
+  _parseResult = nil;
+  _document = nil;
+  _statistics = nil;
+  _readDuration = 0;
+  _inputByteCount = 0;
+  _truncated = NO;
+  _numberOfMessages = 0;
 
   return self;
 }
@@ -61,19 +100,29 @@
 - (void) dealloc
 {
   _wrappedDocumentReadResult = nullptr;
+  _wrappedDocument = nullptr;
   _parseResult = nil;
   _document = nil;
+  _statistics = nil;
 }
 
 #pragma mark - Public API
 
 - (SGFCExitCode) exitCode
 {
+  // A read operation that bypassed SGFC did not encounter any problems,
+  // otherwise it would have fallen back to SGFC
+  if (_wrappedDocumentReadResult == nullptr)
+    return SGFCExitCodeOk;
+
   return [SGFCMappingUtility toSgfcKitExitCode:_wrappedDocumentReadResult->GetExitCode()];
 }
 
 - (BOOL) isSgfDataValid
 {
+  if (_wrappedDocumentReadResult == nullptr)
+    return YES;
+
   return [SGFCMappingUtility toSgfcKitBoolean:_wrappedDocumentReadResult->IsSgfDataValid()];
 }
 
@@ -85,12 +134,32 @@
   }
   else
   {
-    _parseResult = [SGFCWrappingUtility wrapMessages:_wrappedDocumentReadResult->GetParseResult()];
+    _parseResult = [SGFCWrappingUtility wrapMessages:[self wrappedParseResult]];
   }
 
   return _parseResult;
 }
 
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType
+{
+  return [SGFCMessageUtility numberOfMessages:[self wrappedParseResult]
+                                     withType:messageType];
+}
+
+- (NSArray*) messagesWithType:(SGFCMessageType)messageType limit:(NSUInteger)limit
+{
+  return [SGFCMessageUtility messages:[self wrappedParseResult]
+                             withType:messageType
+                                limit:limit
+                      wrappedMessages:_parseResult];
+}
+
+- (SGFCMessage*) firstCriticalMessage
+{
+  return [SGFCMessageUtility firstCriticalMessage:[self wrappedParseResult]
+                                  wrappedMessages:_parseResult];
+}
+
 - (SGFCDocument*) document
 {
   if (_document)
@@ -99,22 +168,94 @@
   }
   else
   {
-    _document = [SGFCWrappingUtility wrapDocument:_wrappedDocumentReadResult->GetDocument()];
+    _document = [SGFCWrappingUtility wrapDocument:[self wrappedDocument]];
   }
 
   return _document;
 }
 
+- (BOOL) isTruncated
+{
+  return _truncated;
+}
+
+- (BOOL) isTrustedInputResult
+{
+  return (_wrappedDocumentReadResult == nullptr);
+}
+
+- (SGFCDocumentReadStatistics*) statistics
+{
+  if (_statistics)
+  {
+    // Reuse a previously created object to provide stable statistics.
+  }
+  else
+  {
+    _statistics = [[SGFCDocumentReadStatistics alloc] initWithParseResult:[self wrappedParseResult]
+                                                                 document:[self wrappedDocument]
+                                                             readDuration:_readDuration
+                                                           inputByteCount:_inputByteCount];
+  }
+
+  return _statistics;
+}
+
 - (void) debugPrintToConsole
 {
-  _wrappedDocumentReadResult->DebugPrintToConsole();
+  if (_wrappedDocumentReadResult == nullptr)
+    _wrappedDocument->DebugPrintToConsole();
+  else
+    _wrappedDocumentReadResult->DebugPrintToConsole();
 }
 
 #pragma mark - Internal API - SGFCDocumentReadResultInternalAdditions overrides
 
+- (void) setReadDuration:(NSTimeInterval)readDuration
+          inputByteCount:(unsigned long long)inputByteCount
+{
+  _readDuration = readDuration;
+  _inputByteCount = inputByteCount;
+}
+
+- (void) truncateAfterMessageAtIndex:(NSUInteger)indexOfMessage
+{
+  _truncated = YES;
+  _numberOfMessages = indexOfMessage + 1;
+}
+
 - (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>) wrappedDocumentReadResult
 {
   return _wrappedDocumentReadResult;
 }
 
+#pragma mark - Private API
+
+// Returns the messages of the wrapped read result, without the messages
+// that were discarded by truncateAfterMessageAtIndex:().
+- (std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>) wrappedParseResult
+{
+  // A read operation that bypassed SGFC has no messages
+  if (_wrappedDocumentReadResult == nullptr)
+    return std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>();
+
+  auto parseResult = _wrappedDocumentReadResult->GetParseResult();
+  if (_truncated && parseResult.size() > _numberOfMessages)
+    parseResult.resize(_numberOfMessages);
+
+  return parseResult;
+}
+
+// Returns the document of the wrapped read result, or an empty document if
+// the result was truncated by truncateAfterMessageAtIndex:().
+- (std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>) wrappedDocument
+{
+  if (_wrappedDocumentReadResult == nullptr)
+    return _wrappedDocument;
+  else if (_truncated)
+    return LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocument();
+  else
+    return _wrappedDocumentReadResult->GetDocument();
+}
+
 @end
@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../../include/SGFCDocumentReadStatistics.h"
+#import "../../interface/internal/SGFCDocumentReadStatisticsInternalAdditions.h"
+#import "../../SGFCMappingUtility.h"
+
+// libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocument.h>
+#import <libsgfcplusplus/ISgfcGame.h>
+#import <libsgfcplusplus/ISgfcMessage.h>
+#import <libsgfcplusplus/ISgfcNode.h>
+#import <libsgfcplusplus/ISgfcProperty.h>
+
+// C++ Standard Library includes
+#import <algorithm>
+#import <map>
+#import <utility>
+#import <vector>
+
+#pragma mark - Class extension
+
+@interface SGFCDocumentReadStatistics()
+{
+  std::map<SGFCMessageType, NSUInteger> _messageCounts;
+}
+
+- (instancetype) initWithParseResult:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)parseResult
+                            document:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document
+                        readDuration:(NSTimeInterval)readDuration
+                      inputByteCount:(unsigned long long)inputByteCount NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation SGFCDocumentReadStatistics
+
+#pragma mark - Initialization and deallocation
+
+- (instancetype) initWithParseResult:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)parseResult
+                            document:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document
+                        readDuration:(NSTimeInterval)readDuration
+                      inputByteCount:(unsigned long long)inputByteCount
+{
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  _readDuration = readDuration;
+  _inputByteCount = inputByteCount;
+
+  for (const auto& message : parseResult)
+    _messageCounts[[SGFCMappingUtility toSgfcKitMessageType:message->GetMessageType()]]++;
+
+  [self countContentOfDocument:document];
+
+  return self;
+}
+
+#pragma mark - Public API
+
+- (NSUInteger) messageCountWithType:(SGFCMessageType)messageType
+{
+  auto it = _messageCounts.find(messageType);
+  if (it == _messageCounts.end())
+    return 0;
+  else
+    return it->second;
+}
+
+#pragma mark - Private API
+
+- (void) countContentOfDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)document
+{
+  _gameCount = 0;
+  _nodeCount = 0;
+  _propertyCount = 0;
+  _propertyValueCount = 0;
+  _maximumDepth = 0;
+  _variationCount = 0;
+
+  if (document == nullptr)
+    return;
+
+  // Iterate instead of recursing so that deep trees (e.g. long games without
+  // variations) cannot overflow the stack. Each stack entry is a node paired
+  // with its depth.
+  std::vector<std::pair<std::shared_ptr<LibSgfcPlusPlus::ISgfcNode>, NSUInteger>> nodesToVisit;
+  for (const auto& game : document->GetGames())
+  {
+    _gameCount++;
+
+    auto rootNode = game->GetRootNode();
+    if (rootNode != nullptr)
+      nodesToVisit.emplace_back(rootNode, 1);
+
+    while (! nodesToVisit.empty())
+    {
+      auto [node, depth] = std::move(nodesToVisit.back());
+      nodesToVisit.pop_back();
+
+      _nodeCount++;
+      _maximumDepth = std::max(_maximumDepth, depth);
+
+      for (const auto& property : node->GetProperties())
+      {
+        _propertyCount++;
+        _propertyValueCount += property->GetPropertyValues().size();
+      }
+
+      bool isFirstChild = true;
+      for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+      {
+        if (isFirstChild)
+          isFirstChild = false;
+        else
+          _variationCount++;
+
+        nodesToVisit.emplace_back(child, depth + 1);
+      }
+    }
+  }
+}
+
+@end
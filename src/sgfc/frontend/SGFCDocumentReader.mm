@@ -16,15 +16,31 @@
 
 // Project includes
 #import "../../../include/SGFCDocumentReader.h"
+#import "../../interface/internal/SGFCCompiledArgumentsInternalAdditions.h"
+#import "../../interface/internal/SGFCDocumentReadResultInternalAdditions.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
+#import "../../SGFCExceptionUtility.h"
 #import "../../SGFCMappingUtility.h"
+#import "../../SGFCMessageUtility.h"
+#import "../../SGFCTrustedInputParser.h"
 #import "../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcArguments.h>
+#import <libsgfcplusplus/ISgfcDocumentReadResult.h>
 #import <libsgfcplusplus/ISgfcDocumentReader.h>
+#import <libsgfcplusplus/ISgfcMessage.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
+// C++ Standard Library includes
+#import <chrono>
+#import <functional>
+#import <string>
+
 // System includes
 #import <Foundation/NSArray.h>
+#import <Foundation/NSData.h>
+#import <Foundation/NSFileManager.h>
 
 #pragma mark - Class extension
 
@@ -34,6 +50,7 @@
 }
 
 @property(nonatomic, strong, readwrite) SGFCArguments* arguments;
+@property(nonatomic, strong) SGFCCompiledArguments* compiledArguments;
 
 @end
 
@@ -46,6 +63,11 @@
   return [[self alloc] init];
 }
 
++ (instancetype) documentReaderWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [[self alloc] initWithCompiledArguments:compiledArguments];
+}
+
 - (instancetype) init
 {
   // Call designated initializer of superclass (NSObject)
@@ -54,7 +76,31 @@
     return nil;
 
   _wrappedDocumentReader = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocumentReader();
-  self.arguments = [SGFCWrappingUtility wrapArguments:_wrappedDocumentReader->GetArguments()];
+  self.arguments = nil;
+  self.compiledArguments = nil;
+  self.failsFast = NO;
+  self.failsFastOnErrors = NO;
+  self.messageHandler = nil;
+  self.trustsInput = NO;
+
+  return self;
+}
+
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:compiledArguments
+                                                 invalidArgumentName:@"compiledArguments"];
+  if (! compiledArguments.isValid)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"compiledArguments\" is not valid"];
+
+  self = [self init];
+  if (! self)
+    return nil;
+
+  // This works only because the wrapper object for the arguments has not
+  // been created yet
+  [compiledArguments copyArgumentsToWrappedArguments:_wrappedDocumentReader->GetArguments()];
+  self.compiledArguments = compiledArguments;
 
   return self;
 }
@@ -63,22 +109,213 @@
 {
   _wrappedDocumentReader = nullptr;
   self.arguments = nil;
+  self.compiledArguments = nil;
+  self.messageHandler = nil;
 }
 
 #pragma mark - Public API
 
+- (SGFCArguments*) arguments
+{
+  if (_arguments)
+  {
+    // Reuse a previously created wrapper object, it remains valid for the
+    // lifetime of the wrapped libsgfc++ object
+  }
+  else
+  {
+    _arguments = [SGFCWrappingUtility wrapArguments:_wrappedDocumentReader->GetArguments()];
+  }
+
+  return _arguments;
+}
+
 - (SGFCDocumentReadResult*) readSgfContentFromFile:(NSString*)sgfFilePath
 {
-  auto wrappedDocumentReadResult = _wrappedDocumentReader->ReadSgfFile(
-    [SGFCMappingUtility fromSgfcKitString:sgfFilePath]);
-  return [SGFCWrappingUtility wrapDocumentReadResult:wrappedDocumentReadResult];
+  std::string wrappedSgfFilePath = [SGFCMappingUtility fromSgfcKitString:sgfFilePath];
+
+  // The file size is determined before reading so that the measured read
+  // duration does not include the file system lookup
+  NSDictionary* fileAttributes = [[NSFileManager defaultManager] attributesOfItemAtPath:sgfFilePath error:nil];
+
+  if ([self canBypassSgfc])
+  {
+    auto startTime = std::chrono::steady_clock::now();
+    NSData* sgfData = [NSData dataWithContentsOfFile:sgfFilePath];
+    if (sgfData)
+    {
+      std::string trustedSgfContent(static_cast<const char*>(sgfData.bytes), sgfData.length);
+      SGFCDocumentReadResult* documentReadResult = [self readTrustedSgfContent:trustedSgfContent
+                                                                     startTime:startTime];
+      if (documentReadResult)
+        return documentReadResult;
+    }
+  }
+
+  auto readFunction = [&]()
+  {
+    return _wrappedDocumentReader->ReadSgfFile(wrappedSgfFilePath);
+  };
+
+  return [self readSgfContentWithReadFunction:readFunction
+                               inputByteCount:fileAttributes.fileSize];
 }
 
 - (SGFCDocumentReadResult*) readSgfContentFromString:(NSString*)sgfContent
 {
-  auto wrappedDocumentReadResult = _wrappedDocumentReader->ReadSgfContent(
-    [SGFCMappingUtility fromSgfcKitString:sgfContent]);
-  return [SGFCWrappingUtility wrapDocumentReadResult:wrappedDocumentReadResult];
+  std::string wrappedSgfContent = [SGFCMappingUtility fromSgfcKitString:sgfContent];
+
+  if ([self canBypassSgfc])
+  {
+    SGFCDocumentReadResult* documentReadResult = [self readTrustedSgfContent:wrappedSgfContent
+                                                                   startTime:std::chrono::steady_clock::now()];
+    if (documentReadResult)
+      return documentReadResult;
+  }
+
+  auto readFunction = [&]()
+  {
+    return _wrappedDocumentReader->ReadSgfContent(wrappedSgfContent);
+  };
+
+  return [self readSgfContentWithReadFunction:readFunction
+                               inputByteCount:wrappedSgfContent.size()];
+}
+
+- (void) reset
+{
+  // Clients can change the arguments only through the wrapper object. If
+  // the wrapper object has never been created the arguments are still the
+  // ones that were set up during initialization.
+  if (_arguments)
+  {
+    _wrappedDocumentReader = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocumentReader();
+    if (self.compiledArguments)
+      [self.compiledArguments copyArgumentsToWrappedArguments:_wrappedDocumentReader->GetArguments()];
+    self.arguments = nil;
+  }
+
+  self.failsFast = NO;
+  self.failsFastOnErrors = NO;
+  self.messageHandler = nil;
+  self.trustsInput = NO;
+}
+
+#pragma mark - Private API
+
+// Performs the read operation @a readFunction, measures its duration and
+// returns the wrapped result. @a inputByteCount is the number of bytes that
+// @a readFunction reads.
+- (SGFCDocumentReadResult*) readSgfContentWithReadFunction:(const std::function<std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentReadResult>()>&)readFunction
+                                            inputByteCount:(unsigned long long)inputByteCount
+{
+  auto startTime = std::chrono::steady_clock::now();
+  auto wrappedDocumentReadResult = readFunction();
+  auto readDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+
+  SGFCDocumentReadResult* documentReadResult = [SGFCWrappingUtility wrapDocumentReadResult:wrappedDocumentReadResult];
+  [self recordReadDuration:readDuration
+            inputByteCount:inputByteCount
+           wrappedDocument:wrappedDocumentReadResult->GetDocument()
+      inDocumentReadResult:documentReadResult];
+
+  if (self.failsFast || self.failsFastOnErrors || self.messageHandler)
+  {
+    NSUInteger indexOfLastMessage = [self indexOfLastMessageToProcess:wrappedDocumentReadResult->GetParseResult()];
+    if (indexOfLastMessage != NSNotFound)
+      [documentReadResult truncateAfterMessageAtIndex:indexOfLastMessage];
+  }
+
+  return documentReadResult;
+}
+
+// Returns true if a read operation can bypass SGFC. This is the case only
+// if the client trusts the input, and if there are no arguments that
+// SGFC would have to apply.
+- (bool) canBypassSgfc
+{
+  return (self.trustsInput && ! _wrappedDocumentReader->GetArguments()->HasArguments());
+}
+
+// Parses @a sgfContent with SGFCTrustedInputParser, bypassing SGFC, and
+// returns the result. @a startTime is the time when the read operation
+// started. Returns nil if SGFCTrustedInputParser cannot handle
+// @a sgfContent, in which case the caller must fall back to SGFC.
+- (SGFCDocumentReadResult*) readTrustedSgfContent:(const std::string&)sgfContent
+                                        startTime:(std::chrono::steady_clock::time_point)startTime
+{
+  auto wrappedDocument = [SGFCTrustedInputParser parseSgfContent:sgfContent];
+  if (wrappedDocument == nullptr)
+    return nil;
+
+  auto readDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+
+  // There are no messages, so fail fast settings and the message handler
+  // do not apply
+  SGFCDocumentReadResult* documentReadResult = [[SGFCDocumentReadResult alloc] initWithWrappedDocument:wrappedDocument];
+  [self recordReadDuration:readDuration
+            inputByteCount:sgfContent.size()
+           wrappedDocument:wrappedDocument
+      inDocumentReadResult:documentReadResult];
+
+  return documentReadResult;
+}
+
+// Passes the values measured during a read operation to
+// @a documentReadResult and, if enabled, to SGFCKitMetrics.
+// @a wrappedDocument is the document that the read operation produced.
+- (void) recordReadDuration:(std::chrono::nanoseconds)readDuration
+             inputByteCount:(unsigned long long)inputByteCount
+            wrappedDocument:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocument>)wrappedDocument
+       inDocumentReadResult:(SGFCDocumentReadResult*)documentReadResult
+{
+  if (SGFCKitMetricsIsEnabled())
+  {
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::ReadCount);
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::ReadDuration, readDuration.count());
+    SGFCKitMetricsAdd(SGFCKitMetricsCounter::BytesRead, inputByteCount);
+    [SGFCKitMetrics recordContentOfDocument:wrappedDocument];
+  }
+
+  [documentReadResult setReadDuration:readDuration.count() / 1000000000.0
+                       inputByteCount:inputByteCount];
+}
+
+// Returns the index of the message in @a parseResult after which the read
+// operation stops, either because it fails fast on the message according
+// to the current fail fast settings, or because the message handler
+// requested to stop. Passes the messages up to that index to the message
+// handler. Returns NSNotFound if the read operation does not stop early.
+- (NSUInteger) indexOfLastMessageToProcess:(const std::vector<std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>>&)parseResult
+{
+  NSUInteger indexOfFailingMessage = NSNotFound;
+
+  if (self.failsFast || self.failsFastOnErrors)
+  {
+    NSUInteger numberOfMessages = parseResult.size();
+    for (NSUInteger indexOfMessage = 0; indexOfMessage < numberOfMessages; indexOfMessage++)
+    {
+      auto messageType = parseResult[indexOfMessage]->GetMessageType();
+      if (messageType == LibSgfcPlusPlus::SgfcMessageType::FatalError ||
+          (messageType == LibSgfcPlusPlus::SgfcMessageType::Error && self.failsFastOnErrors))
+      {
+        indexOfFailingMessage = indexOfMessage;
+        break;
+      }
+    }
+  }
+
+  if (self.messageHandler)
+  {
+    NSUInteger limit = (indexOfFailingMessage == NSNotFound) ? NSUIntegerMax : indexOfFailingMessage + 1;
+    NSUInteger indexOfStopMessage = [SGFCMessageUtility passMessages:parseResult
+                                                               limit:limit
+                                                    toMessageHandler:self.messageHandler];
+    if (indexOfStopMessage != NSNotFound)
+      return indexOfStopMessage;
+  }
+
+  return indexOfFailingMessage;
 }
 
 @end
@@ -17,17 +17,22 @@
 // Project includes
 #import "../../../include/SGFCArguments.h"
 #import "../../../include/SGFCDocumentWriter.h"
+#import "../../interface/internal/SGFCCompiledArgumentsInternalAdditions.h"
 #import "../../interface/internal/SGFCDocumentInternalAdditions.h"
+#import "../../interface/internal/SGFCKitMetricsInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
 #import "../../SGFCMappingUtility.h"
+#import "../../SGFCMessageUtility.h"
 #import "../../SGFCWrappingUtility.h"
 
 // libsgfc++ includes
+#import <libsgfcplusplus/ISgfcDocumentWriteResult.h>
 #import <libsgfcplusplus/ISgfcDocumentWriter.h>
 #import <libsgfcplusplus/SgfcPlusPlusFactory.h>
 
 // System includes
 #import <Foundation/NSArray.h>
+#import <Foundation/NSFileManager.h>
 
 #pragma mark - Class extension
 
@@ -37,6 +42,7 @@
 }
 
 @property(nonatomic, strong, readwrite) SGFCArguments* arguments;
+@property(nonatomic, strong) SGFCCompiledArguments* compiledArguments;
 
 @end
 
@@ -49,6 +55,11 @@
   return [[self alloc] init];
 }
 
++ (instancetype) documentWriterWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  return [[self alloc] initWithCompiledArguments:compiledArguments];
+}
+
 - (instancetype) init
 {
   // Call designated initializer of superclass (NSObject)
@@ -57,7 +68,28 @@
     return nil;
 
   _wrappedDocumentWriter = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocumentWriter();
-  self.arguments = [SGFCWrappingUtility wrapArguments:_wrappedDocumentWriter->GetArguments()];
+  self.arguments = nil;
+  self.compiledArguments = nil;
+  self.messageHandler = nil;
+
+  return self;
+}
+
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:compiledArguments
+                                                 invalidArgumentName:@"compiledArguments"];
+  if (! compiledArguments.isValid)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"compiledArguments\" is not valid"];
+
+  self = [self init];
+  if (! self)
+    return nil;
+
+  // This works only because the wrapper object for the arguments has not
+  // been created yet
+  [compiledArguments copyArgumentsToWrappedArguments:_wrappedDocumentWriter->GetArguments()];
+  self.compiledArguments = compiledArguments;
 
   return self;
 }
@@ -66,18 +98,49 @@
 {
   _wrappedDocumentWriter = nullptr;
   self.arguments = nil;
+  self.compiledArguments = nil;
+  self.messageHandler = nil;
 }
 
 #pragma mark - Public API
 
+- (SGFCArguments*) arguments
+{
+  if (_arguments)
+  {
+    // Reuse a previously created wrapper object, it remains valid for the
+    // lifetime of the wrapped libsgfc++ object
+  }
+  else
+  {
+    _arguments = [SGFCWrappingUtility wrapArguments:_wrappedDocumentWriter->GetArguments()];
+  }
+
+  return _arguments;
+}
+
 - (SGFCDocumentWriteResult*) writeSgfContent:(SGFCDocument*)document
                                       toFile:(NSString*)sgfFilePath
 {
   try
   {
-    auto wrappedDocumentWriteResult = _wrappedDocumentWriter->WriteSgfFile(
-      [document wrappedDocument],
-      [SGFCMappingUtility fromSgfcKitString:sgfFilePath]);
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentWriteResult> wrappedDocumentWriteResult;
+    {
+      SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WriteDuration);
+      wrappedDocumentWriteResult = _wrappedDocumentWriter->WriteSgfFile(
+        [document wrappedDocument],
+        [SGFCMappingUtility fromSgfcKitString:sgfFilePath]);
+    }
+
+    if (SGFCKitMetricsIsEnabled())
+    {
+      NSDictionary* fileAttributes = [[NSFileManager defaultManager] attributesOfItemAtPath:sgfFilePath error:nil];
+      [self recordMetricsForDocument:document
+                        bytesWritten:fileAttributes.fileSize];
+    }
+
+    [self passMessagesToMessageHandler:wrappedDocumentWriteResult];
+
     return [SGFCWrappingUtility wrapDocumentWriteResult:wrappedDocumentWriteResult];
   }
   catch (std::logic_error& exception)
@@ -97,12 +160,24 @@
   try
   {
     std::string wrappedSgfContent;
-    auto wrappedDocumentWriteResult = _wrappedDocumentWriter->WriteSgfContent(
-      [document wrappedDocument],
-      wrappedSgfContent);
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentWriteResult> wrappedDocumentWriteResult;
+    {
+      SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WriteDuration);
+      wrappedDocumentWriteResult = _wrappedDocumentWriter->WriteSgfContent(
+        [document wrappedDocument],
+        wrappedSgfContent);
+    }
+
+    if (SGFCKitMetricsIsEnabled())
+    {
+      [self recordMetricsForDocument:document
+                        bytesWritten:wrappedSgfContent.size()];
+    }
 
     *sgfContent = [SGFCMappingUtility toSgfcKitString:wrappedSgfContent];
 
+    [self passMessagesToMessageHandler:wrappedDocumentWriteResult];
+
     return [SGFCWrappingUtility wrapDocumentWriteResult:wrappedDocumentWriteResult];
   }
   catch (std::logic_error& exception)
@@ -119,8 +194,21 @@
 {
   try
   {
-    auto wrappedDocumentWriteResult = _wrappedDocumentWriter->ValidateDocument(
-      [document wrappedDocument]);
+    std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentWriteResult> wrappedDocumentWriteResult;
+    {
+      SGFCKitMetricsStopwatch stopwatch(SGFCKitMetricsCounter::WriteDuration);
+      wrappedDocumentWriteResult = _wrappedDocumentWriter->ValidateDocument(
+        [document wrappedDocument]);
+    }
+
+    if (SGFCKitMetricsIsEnabled())
+    {
+      [self recordMetricsForDocument:document
+                        bytesWritten:0];
+    }
+
+    [self passMessagesToMessageHandler:wrappedDocumentWriteResult];
+
     return [SGFCWrappingUtility wrapDocumentWriteResult:wrappedDocumentWriteResult];
   }
   catch (std::logic_error& exception)
@@ -138,4 +226,40 @@
   _wrappedDocumentWriter->DebugPrintToConsole([document wrappedDocument]);
 }
 
+- (void) reset
+{
+  // Clients can change the arguments only through the wrapper object. If
+  // the wrapper object has never been created the arguments are still the
+  // ones that were set up during initialization.
+  if (_arguments)
+  {
+    _wrappedDocumentWriter = LibSgfcPlusPlus::SgfcPlusPlusFactory::CreateDocumentWriter();
+    if (self.compiledArguments)
+      [self.compiledArguments copyArgumentsToWrappedArguments:_wrappedDocumentWriter->GetArguments()];
+    self.arguments = nil;
+  }
+
+  self.messageHandler = nil;
+}
+
+#pragma mark - Private API
+
+- (void) passMessagesToMessageHandler:(std::shared_ptr<LibSgfcPlusPlus::ISgfcDocumentWriteResult>)wrappedDocumentWriteResult
+{
+  if (! self.messageHandler)
+    return;
+
+  [SGFCMessageUtility passMessages:wrappedDocumentWriteResult->GetParseResult()
+                             limit:NSUIntegerMax
+                  toMessageHandler:self.messageHandler];
+}
+
+- (void) recordMetricsForDocument:(SGFCDocument*)document
+                     bytesWritten:(unsigned long long)bytesWritten
+{
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::WriteCount);
+  SGFCKitMetricsAdd(SGFCKitMetricsCounter::BytesWritten, bytesWritten);
+  [SGFCKitMetrics recordContentOfDocument:[document wrappedDocument]];
+}
+
 @end
@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------
+// Copyright 2026 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#import "../../../include/SGFCCompiledArguments.h"
+#import "../../../include/SGFCDocumentWriter.h"
+#import "../../../include/SGFCDocumentWriterPool.h"
+#import "../../SGFCExceptionUtility.h"
+#import "../../SGFCObjectPool.h"
+
+#pragma mark - Class extension
+
+@interface SGFCDocumentWriterPool()
+
+@property(nonatomic, strong, readwrite) SGFCCompiledArguments* compiledArguments;
+@property(nonatomic, strong) SGFCObjectPool* pool;
+
+@end
+
+@implementation SGFCDocumentWriterPool
+
+#pragma mark - Initialization and deallocation
+
++ (instancetype) poolWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize
+{
+  return [[self alloc] initWithCompiledArguments:compiledArguments
+                                 maximumPoolSize:maximumPoolSize];
+}
+
+- (instancetype) initWithCompiledArguments:(SGFCCompiledArguments*)compiledArguments
+                           maximumPoolSize:(NSUInteger)maximumPoolSize
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:compiledArguments
+                                                 invalidArgumentName:@"compiledArguments"];
+  if (! compiledArguments.isValid)
+    [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Argument \"compiledArguments\" is not valid"];
+
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  self.compiledArguments = compiledArguments;
+  self.pool = [[SGFCObjectPool alloc] initWithMaximumPoolSize:maximumPoolSize
+                                                 factoryBlock:^id()
+  {
+    return [SGFCDocumentWriter documentWriterWithCompiledArguments:compiledArguments];
+  }
+                                                   resetBlock:^(id object)
+  {
+    [(SGFCDocumentWriter*)object reset];
+  }];
+
+  return self;
+}
+
+- (void) dealloc
+{
+  self.compiledArguments = nil;
+  self.pool = nil;
+}
+
+#pragma mark - Public API
+
+- (NSUInteger) maximumPoolSize
+{
+  return self.pool.maximumPoolSize;
+}
+
+- (NSUInteger) numberOfIdleWriters
+{
+  return self.pool.numberOfIdleObjects;
+}
+
+- (NSUInteger) numberOfAcquisitions
+{
+  return self.pool.numberOfAcquisitions;
+}
+
+- (NSUInteger) numberOfHits
+{
+  return self.pool.numberOfHits;
+}
+
+- (double) hitRate
+{
+  return self.pool.hitRate;
+}
+
+- (SGFCDocumentWriter*) acquireWriter
+{
+  return [self.pool acquireObject];
+}
+
+- (void) relinquishWriter:(SGFCDocumentWriter*)writer
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:writer
+                                                 invalidArgumentName:@"writer"];
+
+  [self.pool relinquishObject:writer];
+}
+
+- (void) withWriter:(void (^)(SGFCDocumentWriter* writer))block
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:block
+                                                 invalidArgumentName:@"block"];
+
+  SGFCDocumentWriter* writer = [self acquireWriter];
+
+  @try
+  {
+    block(writer);
+  }
+  @finally
+  {
+    [self relinquishWriter:writer];
+  }
+}
+
+@end
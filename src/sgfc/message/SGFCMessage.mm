@@ -15,6 +15,7 @@
 // -----------------------------------------------------------------------------
 
 // Project includes
+#import "../../../include/SGFCConstants.h"
 #import "../../../include/SGFCMessage.h"
 #import "../../interface/internal/SGFCMessageInternalAdditions.h"
 #import "../../SGFCExceptionUtility.h"
@@ -23,14 +24,25 @@
 // libsgfc++ includes
 #import <libsgfcplusplus/ISgfcMessage.h>
 
+// System includes
+#import <Foundation/NSString.h>
+
 #pragma mark - Class extension
 
 @interface SGFCMessage()
 {
   std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage> _wrappedMessage;
+  NSString* _messageText;
+  NSString* _formattedMessageText;
+  // Used only if the message was not generated by SGFC
+  SGFCMessageID _messageID;
+  SGFCMessageType _messageType;
 }
 
 - (instancetype) initWithWrappedMessage:(std::shared_ptr<LibSgfcPlusPlus::ISgfcMessage>)wrappedMessage NS_DESIGNATED_INITIALIZER;
+- (instancetype) initWithMessageID:(SGFCMessageID)messageID
+                       messageType:(SGFCMessageType)messageType
+                       messageText:(NSString*)messageText NS_DESIGNATED_INITIALIZER;
 
 @end
 
@@ -49,6 +61,29 @@
     [SGFCExceptionUtility raiseInvalidArgumentExceptionWithReason:@"Message \"wrappedMessage\" is nullptr"];
 
   _wrappedMessage = wrappedMessage;
+  _messageText = nil;
+  _formattedMessageText = nil;
+
+  return self;
+}
+
+- (instancetype) initWithMessageID:(SGFCMessageID)messageID
+                       messageType:(SGFCMessageType)messageType
+                       messageText:(NSString*)messageText
+{
+  [SGFCExceptionUtility raiseInvalidArgumentExceptionIfArgumentIsNil:messageText
+                                                 invalidArgumentName:@"messageText"];
+
+  // Call designated initializer of superclass (NSObject)
+  self = [super init];
+  if (! self)
+    return nil;
+
+  _wrappedMessage = nullptr;
+  _messageID = messageID;
+  _messageType = messageType;
+  _messageText = [messageText copy];
+  _formattedMessageText = nil;
 
   return self;
 }
@@ -56,48 +91,91 @@
 - (void) dealloc
 {
   _wrappedMessage = nullptr;
+  _messageText = nil;
+  _formattedMessageText = nil;
 }
 
 #pragma mark - Public API
 
 - (SGFCMessageID) messageID
 {
+  if (_wrappedMessage == nullptr)
+    return _messageID;
+
   return [SGFCMappingUtility toSgfcKitMessageID:_wrappedMessage->GetMessageID()];
 }
 
 - (SGFCMessageType) messageType
 {
+  if (_wrappedMessage == nullptr)
+    return _messageType;
+
   return [SGFCMappingUtility toSgfcKitMessageType:_wrappedMessage->GetMessageType()];
 }
 
 - (SGFCTextOffset) lineNumber
 {
+  if (_wrappedMessage == nullptr)
+    return SGFCInvalidLineNumber;
+
   return [SGFCMappingUtility toSgfcKitTextOffset:_wrappedMessage->GetLineNumber()];
 }
 
 - (SGFCTextOffset) columnNumber
 {
+  if (_wrappedMessage == nullptr)
+    return SGFCInvalidColumnNumber;
+
   return [SGFCMappingUtility toSgfcKitTextOffset:_wrappedMessage->GetColumnNumber()];
 }
 
 - (BOOL) isCriticalMessage
 {
+  if (_wrappedMessage == nullptr)
+    return NO;
+
   return [SGFCMappingUtility toSgfcKitBoolean:_wrappedMessage->IsCriticalMessage()];
 }
 
 - (NSInteger) libraryErrorNumber
 {
+  if (_wrappedMessage == nullptr)
+    return SGFCLibraryErrorNumberNoError;
+
   return [SGFCMappingUtility toSgfcKitInteger:_wrappedMessage->GetLibraryErrorNumber()];
 }
 
 - (NSString*) messageText
 {
-  return [SGFCMappingUtility toSgfcKitString:_wrappedMessage->GetMessageText()];
+  if (_messageText)
+  {
+    // Reuse a previously created string, the message is immutable.
+  }
+  else
+  {
+    _messageText = [SGFCMappingUtility toSgfcKitString:_wrappedMessage->GetMessageText()];
+  }
+
+  return _messageText;
 }
 
 - (NSString*) formattedMessageText
 {
-  return [SGFCMappingUtility toSgfcKitString:_wrappedMessage->GetFormattedMessageText()];
+  // The formatted message text is usually much longer than the message text
+  // and is needed only for display, so it is created on first access
+  if (_formattedMessageText)
+  {
+    // Reuse a previously created string, the message is immutable.
+  }
+  else
+  {
+    if (_wrappedMessage == nullptr)
+      _formattedMessageText = [SGFCMessage formattedMessageTextWithMessageID:_messageID messageType:_messageType messageText:_messageText];
+    else
+      _formattedMessageText = [SGFCMappingUtility toSgfcKitString:_wrappedMessage->GetFormattedMessageText()];
+  }
+
+  return _formattedMessageText;
 }
 
 #pragma mark - Internal API - SGFCMessageInternalAdditions overrides
@@ -107,4 +185,29 @@
   return _wrappedMessage;
 }
 
+#pragma mark - Private API
+
+// Mimics the format that SGFC uses for messages without a line and column
+// number
++ (NSString*) formattedMessageTextWithMessageID:(SGFCMessageID)messageID
+                                    messageType:(SGFCMessageType)messageType
+                                    messageText:(NSString*)messageText
+{
+  NSString* messageTypeString;
+  switch (messageType)
+  {
+    case SGFCMessageTypeWarning:
+      messageTypeString = @"Warning";
+      break;
+    case SGFCMessageTypeError:
+      messageTypeString = @"Error";
+      break;
+    default:
+      messageTypeString = @"Fatal error";
+      break;
+  }
+
+  return [NSString stringWithFormat:@"%@ %ld: %@", messageTypeString, static_cast<long>(messageID), messageText];
+}
+
 @end